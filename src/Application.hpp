@@ -2,8 +2,12 @@
 
 #include "core/StateManager.hpp"
 #include "core/AssetManager.hpp"
+#include "ecs/BehaviorTree.hpp"
+#include "game/RoomTemplate.hpp"
 #include "states/MainMenuState.hpp"
 #include <SFML/Graphics.hpp>
+#include <filesystem>
+#include <cstdlib>
 
 class Application {
 public:
@@ -31,6 +35,7 @@ public:
                 continue;
             }
 
+            AssetManager::instance().update();
             stateManager.update(dt);
 
             window.clear();
@@ -41,7 +46,23 @@ public:
 
 private:
     void loadAssets() {
-        AssetManager::instance().loadFont("pixel", "assets/fonts/PressStart2P-Regular.ttf");
+        // Prefer the packed archive when one has been built
+        if (std::filesystem::exists(ASSET_PACK_PATH)) {
+            AssetManager::instance().mountPack(ASSET_PACK_PATH);
+        }
+        // Everything else loads on first use or through a state's preload group
+        AssetManager::instance().setMemoryBudget(ASSET_MEMORY_BUDGET);
+        AssetManager::instance().loadManifest(ASSET_MANIFEST_PATH);
+        AssetManager::instance().preload("menu");
+
+        // Before any floor is generated: rooms point into the library
+        RoomTemplateLibrary::instance().loadFromFile(ROOM_TEMPLATES_PATH);
+        BehaviorTreeLibrary::instance().loadFromFile(BEHAVIOR_TREES_PATH);
+
+        // Opt-in for asset iteration: DUNGEON_HOT_RELOAD=1 ./DungeonCrawler
+        if (std::getenv("DUNGEON_HOT_RELOAD")) {
+            AssetManager::instance().enableHotReload();
+        }
     }
 
     void processEvents() {
@@ -60,4 +81,9 @@ private:
 
     static constexpr unsigned int WINDOW_WIDTH = 800;
     static constexpr unsigned int WINDOW_HEIGHT = 600;
+    static constexpr size_t ASSET_MEMORY_BUDGET = 256u * 1024u * 1024u;
+    static constexpr const char* ASSET_MANIFEST_PATH = "assets/manifest.txt";
+    static constexpr const char* ASSET_PACK_PATH = "assets/assets.pak";
+    static constexpr const char* ROOM_TEMPLATES_PATH = "assets/rooms/templates.txt";
+    static constexpr const char* BEHAVIOR_TREES_PATH = "assets/ai/behaviors.txt";
 };
@@ -0,0 +1,148 @@
+#pragma once
+
+#include "VoiceAllocator.hpp"
+#include "../core/AssetManager.hpp"
+#include "../core/EventBus.hpp"
+#include "../core/StringId.hpp"
+#include <SFML/Audio.hpp>
+#include <cmath>
+#include <optional>
+#include <vector>
+
+// Sound effect definition
+struct SfxDef {
+    StringId buffer;           // Sound buffer id in AssetManager
+    int priority = 0;          // Higher wins when voices run out
+    int maxConcurrent = 4;     // Instances of this effect playing at once
+    float volume = 100.f;
+    float maxDistance = 0.f;   // Culled beyond this distance (0 = never)
+};
+
+// Plays sound effects on a fixed pool of sf::Sound voices, so a burst of
+// hundreds of events costs at most voiceCount OpenAL sources. Volume falls
+// off linearly with distance from the listener.
+class AudioSystem {
+public:
+    explicit AudioSystem(size_t voiceCount = DEFAULT_VOICES)
+        : allocator(voiceCount), sounds(voiceCount) {
+        registerSfx(intern("enemy_die"), {intern("enemy_die"), 1, 4, 80.f, 700.f});
+        registerSfx(intern("pickup"), {intern("pickup"), 2, 2, 100.f, 0.f});
+        registerSfx(intern("player_hurt"), {intern("player_hurt"), 3, 1, 100.f, 0.f});
+    }
+
+    ~AudioSystem() {
+        for (auto& sound : sounds) {
+            if (sound) sound->stop();
+        }
+        for (const auto& def : defs) {
+            if (def) AssetManager::instance().unpinSoundBuffer(def->buffer);
+        }
+    }
+
+    AudioSystem(const AudioSystem&) = delete;
+    AudioSystem& operator=(const AudioSystem&) = delete;
+
+    // Buffers of registered effects are pinned so they are never evicted
+    // while a voice may be playing them
+    void registerSfx(StringId id, const SfxDef& def) {
+        if (id.value >= defs.size()) defs.resize(id.value + 1);
+        if (defs[id.value]) AssetManager::instance().unpinSoundBuffer(defs[id.value]->buffer);
+        defs[id.value] = def;
+        AssetManager::instance().pinSoundBuffer(def.buffer);
+    }
+
+    // Call after EventBus::clear(), like the other subscribers
+    void subscribe() {
+        static const StringId enemyDie = intern("enemy_die");
+        static const StringId pickup = intern("pickup");
+        static const StringId playerHurt = intern("player_hurt");
+
+        EventBus::instance().subscribe<EnemyDiedEvent>([this](const EnemyDiedEvent& e) {
+            play(enemyDie, {e.x, e.y});
+        });
+        EventBus::instance().subscribe<PickupCollectedEvent>([this](const PickupCollectedEvent&) {
+            play(pickup, listener);
+        });
+        EventBus::instance().subscribe<PlayerDamagedEvent>([this](const PlayerDamagedEvent&) {
+            play(playerHurt, listener);
+        });
+        EventBus::instance().subscribe<SoundReloadedEvent>([this](const SoundReloadedEvent& e) {
+            restart(StringId{e.bufferId});
+        });
+    }
+
+    bool play(StringId id, sf::Vector2f position) {
+        if (id.value >= defs.size() || !defs[id.value]) return false;
+        const SfxDef& def = *defs[id.value];
+
+        float gain = 1.f;
+        if (def.maxDistance > 0.f) {
+            sf::Vector2f offset = position - listener;
+            float distSq = offset.x * offset.x + offset.y * offset.y;
+            if (distSq > def.maxDistance * def.maxDistance) {
+                ++culled;
+                return false;
+            }
+            gain = 1.f - std::sqrt(distSq) / def.maxDistance;
+        }
+
+        sf::SoundBuffer* buffer = AssetManager::instance().findSoundBuffer(def.buffer);
+        if (!buffer) return false;
+
+        int voice = allocator.allocate(id.value, def.priority, def.maxConcurrent);
+        if (voice < 0) {
+            ++dropped;
+            return false;
+        }
+
+        auto& sound = sounds[voice];
+        if (!sound) {
+            sound.emplace(*buffer);
+        } else {
+            sound->stop();
+            sound->setBuffer(*buffer);
+        }
+        sound->setVolume(def.volume * gain);
+        sound->play();
+        return true;
+    }
+
+    // Frees voices whose sound has finished
+    void update(sf::Vector2f listenerPosition) {
+        listener = listenerPosition;
+        const auto& voices = allocator.getVoices();
+        for (size_t i = 0; i < voices.size(); ++i) {
+            if (voices[i].active && (!sounds[i] || sounds[i]->getStatus() == sf::Sound::Status::Stopped)) {
+                allocator.release(static_cast<int>(i));
+            }
+        }
+    }
+
+    // Replays voices that a hot reload of their buffer stopped, so a live
+    // effect is heard again with the new samples instead of cutting out
+    void restart(StringId buffer) {
+        const auto& voices = allocator.getVoices();
+        for (size_t i = 0; i < voices.size(); ++i) {
+            if (!voices[i].active || !sounds[i]) continue;
+            const auto& def = defs[voices[i].sound];
+            if (def && def->buffer == buffer && sounds[i]->getStatus() == sf::Sound::Status::Stopped) {
+                sounds[i]->play();
+            }
+        }
+    }
+
+    size_t getActiveVoices() const { return allocator.activeCount(); }
+    size_t getStolenCount() const { return allocator.getStolenCount(); }
+    size_t getCulledCount() const { return culled; }
+    size_t getDroppedCount() const { return dropped; }
+
+    static constexpr size_t DEFAULT_VOICES = 16;
+
+private:
+    VoiceAllocator allocator;
+    std::vector<std::optional<sf::Sound>> sounds;
+    std::vector<std::optional<SfxDef>> defs;  // Indexed by StringId
+    sf::Vector2f listener{0.f, 0.f};
+    size_t culled = 0;
+    size_t dropped = 0;
+};
@@ -0,0 +1,214 @@
+#pragma once
+
+#include "../core/AssetManager.hpp"
+#include "../core/StringId.hpp"
+#include <SFML/Audio.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <utility>
+#include <vector>
+
+// Streams music tracks registered with AssetManager and crossfades between
+// them.
+//
+// sf::Music keeps only a small ring of decoded chunks in memory, so a track
+// costs the same whether it is one minute or an hour long. Opening a track
+// (file I/O and decoder setup) happens on a worker thread via prefetch(), so
+// crossfadeTo() never stalls the frame: if the track isn't ready yet the fade
+// starts in update() once it is.
+class MusicPlayer {
+public:
+    using Source = AssetManager::MusicSource;
+    using Lookup = std::function<Source(StringId)>;
+    using Opener = std::unique_ptr<sf::Music> (*)(const Source&);
+
+    // Tracks are looked up in AssetManager and opened with sf::Music unless
+    // told otherwise; the opener runs on a worker thread
+    explicit MusicPlayer(Lookup lookup = findInAssets, Opener opener = open)
+        : lookup(std::move(lookup)), opener(opener) {}
+    ~MusicPlayer() { stop(); }
+
+    MusicPlayer(const MusicPlayer&) = delete;
+    MusicPlayer& operator=(const MusicPlayer&) = delete;
+
+    // Starts opening a track in the background
+    void prefetch(StringId track) {
+        if (track.empty() || isPrefetched(track) || isOpening(track)) return;
+
+        Source source = lookup(track);
+        if (!source.valid()) return;
+
+        opening.emplace_back(track, std::async(std::launch::async,
+                                               [openTrack = opener, source = std::move(source)]() {
+                                                   return openTrack(source);
+                                               }));
+    }
+
+    // Fades from the current track to another one. Unknown tracks fade to
+    // silence.
+    void crossfadeTo(StringId track, float duration = DEFAULT_FADE) {
+        if (track == current.track) {
+            queuedTrack = {};  // Cancels a fade that hasn't started yet
+            return;
+        }
+
+        queuedFade = duration;
+        if (!lookup(track).valid()) {
+            queuedTrack = {};
+            beginFade({});
+            return;
+        }
+
+        queuedTrack = track;
+        prefetch(track);
+        startQueued();
+    }
+
+    void stop() {
+        if (current.music) current.music->stop();
+        if (previous.music) previous.music->stop();
+        current = {};
+        previous = {};
+        queuedTrack = {};
+        prefetched.clear();
+        opening.clear();  // Waits for in-flight opens
+    }
+
+    void update(float dt) {
+        collectOpened();
+
+        if (fadeDuration <= 0.f) return;
+
+        fadeTime = std::min(fadeTime + dt, fadeDuration);
+        applyVolumes();
+        if (fadeTime >= fadeDuration) {
+            if (previous.music) previous.music->stop();
+            previous = {};
+            fadeDuration = 0.f;
+        }
+    }
+
+    void setVolume(float newVolume) {
+        volume = newVolume;
+        applyVolumes();
+    }
+
+    StringId getCurrentTrack() const { return current.track; }
+    bool isFading() const { return fadeDuration > 0.f; }
+    bool isPrefetching() const { return !opening.empty(); }
+
+    // Opened and waiting to be played
+    bool isPrefetched(StringId track) const {
+        for (const auto& [id, music] : prefetched) {
+            if (id == track) return true;
+        }
+        return false;
+    }
+
+    static constexpr float DEFAULT_FADE = 2.f;
+    static constexpr float DEFAULT_VOLUME = 60.f;
+    static constexpr size_t MAX_PREFETCHED = 4;  // Oldest unused track is closed past this
+
+private:
+    struct Deck {
+        std::unique_ptr<sf::Music> music;
+        StringId track;
+    };
+
+    static Source findInAssets(StringId track) {
+        return AssetManager::instance().findMusic(track);
+    }
+
+    // Runs on a worker thread: touches nothing but its own argument
+    static std::unique_ptr<sf::Music> open(const AssetManager::MusicSource& source) {
+        auto music = std::make_unique<sf::Music>();
+        bool ok = source.data ? music->openFromMemory(source.data, source.size)
+                              : music->openFromFile(source.path);
+        if (!ok) return nullptr;
+        music->setLooping(true);
+        return music;
+    }
+
+    bool isOpening(StringId track) const {
+        for (const auto& [id, future] : opening) {
+            if (id == track) return true;
+        }
+        return false;
+    }
+
+    // Takes finished opens without blocking. Each is kept under its own
+    // track, so a queued track arriving late never displaces a prefetch made
+    // for later (the next floor's music); it just starts playing.
+    void collectOpened() {
+        for (auto it = opening.begin(); it != opening.end();) {
+            if (it->second.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+                ++it;
+                continue;
+            }
+            std::unique_ptr<sf::Music> music = it->second.get();
+            if (music) {
+                if (prefetched.size() == MAX_PREFETCHED) prefetched.erase(prefetched.begin());
+                prefetched.emplace_back(it->first, std::move(music));
+                startQueued();
+            } else {
+                std::cerr << "[MusicPlayer] Failed to open track: "
+                          << StringInterner::instance().str(it->first) << "\n";
+                if (queuedTrack == it->first) queuedTrack = {};
+            }
+            it = opening.erase(it);
+        }
+    }
+
+    void startQueued() {
+        if (queuedTrack.empty()) return;
+        auto it = std::find_if(prefetched.begin(), prefetched.end(),
+                               [this](const auto& entry) { return entry.first == queuedTrack; });
+        if (it == prefetched.end()) return;
+
+        Deck next{std::move(it->second), queuedTrack};
+        prefetched.erase(it);
+        queuedTrack = {};
+        next.music->setVolume(0.f);
+        next.music->play();
+        beginFade(std::move(next));
+    }
+
+    void beginFade(Deck next) {
+        // A fade still running drops its outgoing track
+        if (previous.music) previous.music->stop();
+        previous = std::move(current);
+        current = std::move(next);
+        fadeTime = 0.f;
+        fadeDuration = std::max(queuedFade, 0.001f);
+        applyVolumes();
+    }
+
+    // Equal-power curve, so the mix doesn't dip in the middle of a fade
+    void applyVolumes() {
+        float t = fadeDuration > 0.f ? fadeTime / fadeDuration : 1.f;
+        float angle = t * 1.5707963f;
+        if (current.music) current.music->setVolume(volume * std::sin(angle));
+        if (previous.music) previous.music->setVolume(volume * std::cos(angle));
+    }
+
+    Deck current;
+    Deck previous;  // Fading out
+
+    Lookup lookup;
+    Opener opener;
+
+    std::vector<std::pair<StringId, std::unique_ptr<sf::Music>>> prefetched;  // Oldest first
+    std::vector<std::pair<StringId, std::future<std::unique_ptr<sf::Music>>>> opening;
+
+    StringId queuedTrack;  // Waiting for its prefetch to finish
+    float queuedFade = DEFAULT_FADE;
+
+    float fadeTime = 0.f;
+    float fadeDuration = 0.f;
+    float volume = DEFAULT_VOLUME;
+};
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Decides which of a fixed set of voices a new sound plays on.
+//
+// Rules, in order:
+//   1. A sound already playing maxConcurrent times restarts its oldest voice
+//   2. Otherwise a free voice is used
+//   3. Otherwise the oldest voice with the lowest priority not above the new
+//      sound's is stolen
+//   4. Otherwise the new sound is dropped
+class VoiceAllocator {
+public:
+    struct Voice {
+        bool active = false;
+        std::uint32_t sound = 0;
+        int priority = 0;
+        std::uint64_t startedAt = 0;
+    };
+
+    explicit VoiceAllocator(std::size_t voiceCount) : voices(voiceCount) {}
+
+    // Returns the voice index to play on, or -1 to drop the sound
+    int allocate(std::uint32_t sound, int priority, int maxConcurrent) {
+        int oldestSame = -1;
+        int sameCount = 0;
+        int freeVoice = -1;
+        int victim = -1;
+
+        for (int i = 0; i < static_cast<int>(voices.size()); ++i) {
+            const Voice& voice = voices[i];
+            if (!voice.active) {
+                if (freeVoice < 0) freeVoice = i;
+                continue;
+            }
+            if (voice.sound == sound) {
+                ++sameCount;
+                if (oldestSame < 0 || voice.startedAt < voices[oldestSame].startedAt) oldestSame = i;
+            }
+            if (voice.priority <= priority &&
+                (victim < 0 || voice.priority < voices[victim].priority ||
+                 (voice.priority == voices[victim].priority && voice.startedAt < voices[victim].startedAt))) {
+                victim = i;
+            }
+        }
+
+        int chosen = -1;
+        if (maxConcurrent > 0 && sameCount >= maxConcurrent) {
+            chosen = oldestSame;
+        } else if (freeVoice >= 0) {
+            chosen = freeVoice;
+        } else {
+            chosen = victim;
+        }
+
+        if (chosen >= 0) {
+            if (voices[chosen].active) ++stolen;
+            voices[chosen] = {true, sound, priority, nextStart++};
+        }
+        return chosen;
+    }
+
+    void release(int voice) {
+        voices[voice].active = false;
+    }
+
+    const std::vector<Voice>& getVoices() const { return voices; }
+    std::size_t getStolenCount() const { return stolen; }
+
+    std::size_t activeCount() const {
+        std::size_t count = 0;
+        for (const auto& voice : voices) {
+            if (voice.active) ++count;
+        }
+        return count;
+    }
+
+private:
+    std::vector<Voice> voices;
+    std::uint64_t nextStart = 0;
+    std::size_t stolen = 0;
+};
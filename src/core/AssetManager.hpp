@@ -2,12 +2,33 @@
 
 #include <SFML/Graphics.hpp>
 #include <SFML/Audio.hpp>
+#include "AssetPack.hpp"
+#include "AssetManifest.hpp"
+#include "StringId.hpp"
+#include "AssetResidency.hpp"
+#include "AssetWatcher.hpp"
+#include "EventBus.hpp"
 #include <unordered_map>
+#include <map>
+#include <vector>
+#include <future>
+#include <chrono>
+#include <filesystem>
+#include <mutex>
 #include <string>
 #include <memory>
 #include <stdexcept>
 #include <iostream>
 
+// Loads fresh's samples into live in place. Copy-assigning a SoundBuffer
+// swaps its list of attached sounds too, leaving every sf::Sound that
+// played the old data pointing at nothing; loading the samples instead
+// re-attaches those sounds to the same buffer.
+inline bool reloadSoundBuffer(sf::SoundBuffer& live, const sf::SoundBuffer& fresh) {
+    return live.loadFromSamples(fresh.getSamples(), fresh.getSampleCount(), fresh.getChannelCount(),
+                                fresh.getSampleRate(), fresh.getChannelMap());
+}
+
 class AssetManager {
 public:
     static AssetManager& instance() {
@@ -16,93 +37,593 @@ public:
     }
 
     // Textures
-    sf::Texture& getTexture(const std::string& id) {
-        auto it = textures.find(id);
-        if (it != textures.end()) {
-            return *it->second;
+    // Registered textures are loaded on first use
+    sf::Texture& getTexture(StringId id) {
+        if (sf::Texture* texture = textures.use(id, frame)) {
+            return *texture;
+        }
+        if (loadRegistered(textures, id, &AssetManager::loadTexture)) {
+            return *textures.get(id);
         }
         return *placeholderTexture;
     }
 
-    bool loadTexture(const std::string& id, const std::string& path) {
+    sf::Texture& getTexture(const std::string& id) { return getTexture(intern(id)); }
+
+    void registerTexture(StringId id, const std::string& path) { textures.slot(id).path = path; }
+    void registerTexture(const std::string& id, const std::string& path) { registerTexture(intern(id), path); }
+
+    bool loadTexture(StringId id, const std::string& path) {
         auto texture = std::make_unique<sf::Texture>();
-        if (!texture->loadFromFile(path)) {
+        if (!loadTextureFromPack(id, *texture) && !texture->loadFromFile(path)) {
             std::cerr << "[AssetManager] Failed to load texture: " << path << "\n";
             return false;
         }
-        textures[id] = std::move(texture);
+        size_t bytes = static_cast<size_t>(texture->getSize().x) * texture->getSize().y * 4;
+        store(textures, id, std::move(texture), bytes, path);
         return true;
     }
 
-    bool hasTexture(const std::string& id) const {
-        return textures.find(id) != textures.end();
-    }
+    bool loadTexture(const std::string& id, const std::string& path) { return loadTexture(intern(id), path); }
+
+    bool hasTexture(StringId id) const { return textures.get(id) != nullptr; }
+    bool hasTexture(const std::string& id) const { return hasTexture(intern(id)); }
 
     // Fonts
-    sf::Font& getFont(const std::string& id) {
-        auto it = fonts.find(id);
-        if (it != fonts.end()) {
-            return *it->second;
+    sf::Font& getFont(StringId id) {
+        if (sf::Font* font = fonts.use(id, frame)) {
+            return *font;
+        }
+        if (loadRegistered(fonts, id, &AssetManager::loadFont)) {
+            return *fonts.get(id);
         }
         if (!defaultFont) {
-            throw std::runtime_error("No default font loaded and font '" + id + "' not found");
+            throw std::runtime_error("No default font loaded and font '" + StringInterner::instance().str(id) + "' not found");
         }
         return *defaultFont;
     }
 
-    bool loadFont(const std::string& id, const std::string& path) {
+    sf::Font& getFont(const std::string& id) { return getFont(intern(id)); }
+
+    void registerFont(StringId id, const std::string& path) { fonts.slot(id).path = path; }
+    void registerFont(const std::string& id, const std::string& path) { registerFont(intern(id), path); }
+
+    bool loadFont(StringId id, const std::string& path) {
         auto font = std::make_unique<sf::Font>();
-        if (!font->openFromFile(path)) {
+        if (!loadFontFromPack(id, *font) && !font->openFromFile(path)) {
             std::cerr << "[AssetManager] Failed to load font: " << path << "\n";
             return false;
         }
-        fonts[id] = std::move(font);
-        if (!defaultFont) {
-            defaultFont = fonts[id].get();
+        sf::Font* previous = fonts.get(id);
+        store(fonts, id, std::move(font), fontBytes(id, path), path);
+        if (!defaultFont || defaultFont == previous) {
+            defaultFont = fonts.get(id);
         }
         return true;
     }
 
-    bool hasFont(const std::string& id) const {
-        return fonts.find(id) != fonts.end();
-    }
+    bool loadFont(const std::string& id, const std::string& path) { return loadFont(intern(id), path); }
+
+    bool hasFont(StringId id) const { return fonts.get(id) != nullptr; }
+    bool hasFont(const std::string& id) const { return hasFont(intern(id)); }
 
     // Sound Buffers
-    sf::SoundBuffer& getSoundBuffer(const std::string& id) {
-        auto it = soundBuffers.find(id);
-        if (it != soundBuffers.end()) {
-            return *it->second;
+    sf::SoundBuffer& getSoundBuffer(StringId id) {
+        if (sf::SoundBuffer* buffer = soundBuffers.use(id, frame)) {
+            return *buffer;
+        }
+        if (loadRegistered(soundBuffers, id, &AssetManager::loadSoundBuffer)) {
+            return *soundBuffers.get(id);
         }
-        throw std::runtime_error("Sound buffer not found: " + id);
+        throw std::runtime_error("Sound buffer not found: " + StringInterner::instance().str(id));
     }
 
-    bool loadSoundBuffer(const std::string& id, const std::string& path) {
+    sf::SoundBuffer& getSoundBuffer(const std::string& id) { return getSoundBuffer(intern(id)); }
+
+    // Like getSoundBuffer, but returns nullptr instead of throwing
+    sf::SoundBuffer* findSoundBuffer(StringId id) {
+        if (sf::SoundBuffer* buffer = soundBuffers.use(id, frame)) {
+            return buffer;
+        }
+        if (loadRegistered(soundBuffers, id, &AssetManager::loadSoundBuffer)) {
+            return soundBuffers.get(id);
+        }
+        return nullptr;
+    }
+
+    void registerSoundBuffer(StringId id, const std::string& path) { soundBuffers.slot(id).path = path; }
+    void registerSoundBuffer(const std::string& id, const std::string& path) { registerSoundBuffer(intern(id), path); }
+
+    bool loadSoundBuffer(StringId id, const std::string& path) {
         auto buffer = std::make_unique<sf::SoundBuffer>();
-        if (!buffer->loadFromFile(path)) {
+        if (!loadSoundBufferFromPack(id, *buffer) && !buffer->loadFromFile(path)) {
             std::cerr << "[AssetManager] Failed to load sound: " << path << "\n";
             return false;
         }
-        soundBuffers[id] = std::move(buffer);
+        size_t bytes = static_cast<size_t>(buffer->getSampleCount()) * sizeof(std::int16_t);
+        store(soundBuffers, id, std::move(buffer), bytes, path);
         return true;
     }
 
-    bool hasSoundBuffer(const std::string& id) const {
-        return soundBuffers.find(id) != soundBuffers.end();
+    bool loadSoundBuffer(const std::string& id, const std::string& path) { return loadSoundBuffer(intern(id), path); }
+
+    bool hasSoundBuffer(StringId id) const { return soundBuffers.get(id) != nullptr; }
+    bool hasSoundBuffer(const std::string& id) const { return hasSoundBuffer(intern(id)); }
+
+    // Music
+    // Tracks are never decoded here; MusicPlayer streams them from their
+    // file or straight out of the pack mapping.
+    struct MusicSource {
+        const std::uint8_t* data = nullptr;  // Packed file bytes, valid while the pack is mounted
+        size_t size = 0;
+        std::string path;
+
+        bool valid() const { return data || !path.empty(); }
+    };
+
+    void registerMusic(StringId id, const std::string& path) {
+        if (id.value >= musicPaths.size()) musicPaths.resize(id.value + 1);
+        musicPaths[id.value] = path;
+    }
+    void registerMusic(const std::string& id, const std::string& path) { registerMusic(intern(id), path); }
+
+    MusicSource findMusic(StringId id) const {
+        MusicSource source;
+        const AssetPack* pack = nullptr;
+        if (const AssetPack::Entry* entry = findInPacks(id, AssetPack::EntryType::Music, pack)) {
+            source.data = pack->data(*entry);
+            source.size = static_cast<size_t>(entry->size);
+        } else if (id.value < musicPaths.size()) {
+            source.path = musicPaths[id.value];
+        }
+        return source;
     }
 
-    // Clear all loaded assets
+    // Manifest
+    // Registers every entry for lazy loading and records its preload group.
+    bool loadManifest(const std::string& path) {
+        AssetManifest manifest;
+        bool ok = manifest.loadFromFile(path);
+        for (const auto& entry : manifest.getEntries()) {
+            StringId id = intern(entry.id);
+            switch (entry.kind) {
+                case AssetKind::Texture: registerTexture(id, entry.path); break;
+                case AssetKind::Font:    registerFont(id, entry.path); break;
+                case AssetKind::Sound:   registerSoundBuffer(id, entry.path); break;
+                case AssetKind::Music:   registerMusic(id, entry.path); break;
+            }
+            if (!entry.group.empty()) {
+                groups[entry.group].push_back({entry.kind, id, entry.path});
+            }
+        }
+        return ok;
+    }
+
+    // Loads a preload group on the calling thread
+    void preload(const std::string& group) {
+        auto it = groups.find(group);
+        if (it == groups.end()) return;
+
+        for (const auto& item : it->second) {
+            switch (item.kind) {
+                case AssetKind::Texture: if (!hasTexture(item.id)) loadTexture(item.id, item.path); break;
+                case AssetKind::Font:    if (!hasFont(item.id)) loadFont(item.id, item.path); break;
+                case AssetKind::Sound:   if (!hasSoundBuffer(item.id)) loadSoundBuffer(item.id, item.path); break;
+                case AssetKind::Music:   break;  // Streamed, nothing to warm
+            }
+        }
+    }
+
+    // Decodes a preload group on a worker thread. Results are handed over in
+    // update(), so the GPU upload happens on the main thread at a frame
+    // boundary. Anything requested before then is simply loaded on demand.
+    void preloadAsync(const std::string& group) {
+        auto it = groups.find(group);
+        if (it == groups.end()) return;
+
+        std::vector<PreloadItem> work;
+        for (const auto& item : it->second) {
+            // Packed assets are already decoded; fonts open lazily anyway
+            if (item.kind == AssetKind::Font || item.kind == AssetKind::Music || isPacked(item)) continue;
+            if (item.kind == AssetKind::Texture && hasTexture(item.id)) continue;
+            if (item.kind == AssetKind::Sound && hasSoundBuffer(item.id)) continue;
+            work.push_back(item);
+        }
+
+        pendingPreloads.push_back(std::async(std::launch::async, [work = std::move(work)]() {
+            return decodeBatch(work);
+        }));
+        // Packed and font entries finish in update()
+        pendingGroups.push_back(group);
+    }
+    bool isPreloading() const { return !pendingPreloads.empty(); }
+
+    // Memory budget
+    // Textures and sound buffers that can be reloaded from their source are
+    // evicted least-recently-used first once the budget is exceeded.
+    // Fonts count towards residency but stay loaded, since sf::Text keeps
+    // references to them. References returned by get*() stay valid until
+    // the next update() unless the asset is pinned.
+    void setMemoryBudget(size_t bytes) {
+        stats.budgetBytes = bytes;
+    }
+
+    const ResidencyStats& getResidencyStats() const { return stats; }
+
+    // Pinned assets are never evicted; pins nest
+    void pinGroup(const std::string& group) { adjustGroupPins(group, 1); }
+    void unpinGroup(const std::string& group) { adjustGroupPins(group, -1); }
+
+    void pinTexture(StringId id) { ++textures.slot(id).pins; }
+    void unpinTexture(StringId id) { --textures.slot(id).pins; }
+    void pinSoundBuffer(StringId id) { ++soundBuffers.slot(id).pins; }
+    void unpinSoundBuffer(StringId id) { --soundBuffers.slot(id).pins; }
+
+    // Hot reload
+    // Opt-in: watches the source files of every registered texture and sound
+    // buffer. Changed files are decoded on the watcher thread and swapped into
+    // the existing objects in update(), so references held by callers stay
+    // valid and simply see the new contents.
+    bool enableHotReload() {
+        std::vector<std::string> paths;
+        std::map<std::string, std::vector<PreloadItem>> watched;
+        collectWatched(textures, AssetKind::Texture, paths, watched);
+        collectWatched(soundBuffers, AssetKind::Sound, paths, watched);
+
+        return watcher.start(paths, [this, watched = std::move(watched)](const std::string& path) {
+            auto it = watched.find(path);
+            if (it == watched.end()) return;
+
+            DecodedBatch batch = decodeBatch(it->second);
+            std::lock_guard<std::mutex> lock(reloadMutex);
+            reloads.push_back(std::move(batch));
+        });
+    }
+
+    void disableHotReload() {
+        watcher.stop();
+        std::lock_guard<std::mutex> lock(reloadMutex);
+        reloads.clear();
+    }
+
+    bool isHotReloadEnabled() const { return watcher.isRunning(); }
+
+    // Call once per frame to integrate finished background work, apply hot
+    // reloads and enforce the memory budget
+    void update() {
+        ++frame;
+        applyReloads();
+        enforceBudget();
+
+        for (size_t i = 0; i < pendingPreloads.size();) {
+            if (pendingPreloads[i].wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+                ++i;
+                continue;
+            }
+            integrate(pendingPreloads[i].get());
+            preload(pendingGroups[i]);
+            pendingPreloads.erase(pendingPreloads.begin() + i);
+            pendingGroups.erase(pendingGroups.begin() + i);
+        }
+    }
+
+    // Packs
+    // Assets found in a mounted pack are read from it instead of their loose
+    // file. Packs mounted later take precedence over earlier ones.
+    bool mountPack(const std::string& path) {
+        auto pack = std::make_unique<AssetPack>();
+        if (!pack->open(path)) {
+            return false;
+        }
+        packs.push_back(std::move(pack));
+        return true;
+    }
+
+    // Fonts read glyphs straight from the pack mapping, so unmounting also
+    // releases every loaded asset. Stop any music streamed from a pack first.
+    void unmountPacks() {
+        clear();
+        packs.clear();
+    }
+
+    size_t mountedPackCount() const { return packs.size(); }
+
+    // Clear all loaded assets (registrations are kept, so they reload lazily)
     void clear() {
-        textures.clear();
-        fonts.clear();
-        soundBuffers.clear();
+        pendingPreloads.clear();  // Waits for in-flight decodes
+        pendingGroups.clear();
+        textures.clearAssets();
+        fonts.clearAssets();
+        soundBuffers.clearAssets();
+        stats.residentBytes = 0;
+        stats.residentAssets = 0;
         defaultFont = nullptr;
     }
 
 private:
+    // Assets are stored densely by StringId, so a lookup is an array index
+    template<typename T>
+    struct AssetSlot {
+        std::unique_ptr<T> asset;
+        std::string path;  // Registered source, empty if not registered
+        size_t bytes = 0;
+        std::uint64_t lastUsedFrame = 0;
+        int pins = 0;
+        bool evicted = false;
+    };
+
+    template<typename T>
+    struct AssetTable {
+        std::vector<AssetSlot<T>> slots;
+
+        T* get(StringId id) const {
+            return id.value < slots.size() ? slots[id.value].asset.get() : nullptr;
+        }
+
+        // get() that also records the access for LRU eviction
+        T* use(StringId id, std::uint64_t frame) {
+            if (id.value >= slots.size() || !slots[id.value].asset) return nullptr;
+            slots[id.value].lastUsedFrame = frame;
+            return slots[id.value].asset.get();
+        }
+
+        AssetSlot<T>& slot(StringId id) {
+            if (id.value >= slots.size()) slots.resize(id.value + 1);
+            return slots[id.value];
+        }
+
+        void clearAssets() {
+            for (auto& s : slots) {
+                s.asset.reset();
+                s.bytes = 0;
+            }
+        }
+    };
+
+    struct PreloadItem {
+        AssetKind kind;
+        StringId id;
+        std::string path;
+    };
+
     AssetManager() {
         createPlaceholderTexture();
     }
 
+    struct DecodedBatch {
+        std::vector<std::pair<StringId, sf::Image>> images;
+        std::vector<std::pair<StringId, std::unique_ptr<sf::SoundBuffer>>> sounds;
+    };
+
+    // Runs on a worker thread: touches nothing but its own arguments
+    static DecodedBatch decodeBatch(const std::vector<PreloadItem>& work) {
+        DecodedBatch batch;
+        for (const auto& item : work) {
+            if (item.kind == AssetKind::Texture) {
+                sf::Image image;
+                if (image.loadFromFile(item.path)) {
+                    batch.images.emplace_back(item.id, std::move(image));
+                }
+            } else if (item.kind == AssetKind::Sound) {
+                auto buffer = std::make_unique<sf::SoundBuffer>();
+                if (buffer->loadFromFile(item.path)) {
+                    batch.sounds.emplace_back(item.id, std::move(buffer));
+                }
+            }
+        }
+        return batch;
+    }
+
+    void integrate(DecodedBatch batch) {
+        for (auto& [id, image] : batch.images) {
+            if (hasTexture(id)) continue;
+            auto texture = std::make_unique<sf::Texture>();
+            if (texture->loadFromImage(image)) {
+                size_t bytes = static_cast<size_t>(image.getSize().x) * image.getSize().y * 4;
+                store(textures, id, std::move(texture), bytes);
+            }
+        }
+        for (auto& [id, buffer] : batch.sounds) {
+            if (!hasSoundBuffer(id)) {
+                size_t bytes = static_cast<size_t>(buffer->getSampleCount()) * sizeof(std::int16_t);
+                store(soundBuffers, id, std::move(buffer), bytes);
+            }
+        }
+    }
+
+    template<typename T>
+    void collectWatched(const AssetTable<T>& table, AssetKind kind, std::vector<std::string>& paths,
+                        std::map<std::string, std::vector<PreloadItem>>& watched) const {
+        for (std::uint32_t i = 0; i < table.slots.size(); ++i) {
+            const auto& path = table.slots[i].path;
+            if (path.empty()) continue;
+            if (watched.find(path) == watched.end()) paths.push_back(path);
+            watched[path].push_back({kind, StringId{i}, path});
+        }
+    }
+
+    // Swaps freshly decoded data into the live objects so existing
+    // sf::Texture& / sf::SoundBuffer& references stay valid. Sounds playing a
+    // reloaded buffer are stopped by SFML; SoundReloadedEvent lets the audio
+    // system restart them. Assets that are
+    // not resident are skipped; their next load reads the new file anyway.
+    void applyReloads() {
+        std::vector<DecodedBatch> ready;
+        {
+            std::lock_guard<std::mutex> lock(reloadMutex);
+            ready.swap(reloads);
+        }
+
+        for (auto& batch : ready) {
+            for (auto& [id, image] : batch.images) {
+                auto& slot = textures.slot(id);
+                sf::Texture fresh;
+                if (!slot.asset || !fresh.loadFromImage(image)) continue;
+                slot.asset->swap(fresh);
+                resize(slot, static_cast<size_t>(image.getSize().x) * image.getSize().y * 4);
+            }
+            for (auto& [id, buffer] : batch.sounds) {
+                auto& slot = soundBuffers.slot(id);
+                if (!slot.asset) continue;
+                if (!reloadSoundBuffer(*slot.asset, *buffer)) continue;
+                resize(slot, static_cast<size_t>(buffer->getSampleCount()) * sizeof(std::int16_t));
+                EventBus::instance().emit<SoundReloadedEvent>(id.value);
+            }
+        }
+    }
+
+    template<typename T>
+    void resize(AssetSlot<T>& slot, size_t bytes) {
+        stats.residentBytes = stats.residentBytes - slot.bytes + bytes;
+        slot.bytes = bytes;
+    }
+
+    template<typename T>
+    void store(AssetTable<T>& table, StringId id, std::unique_ptr<T> asset, size_t bytes,
+               const std::string& path = {}) {
+        auto& slot = table.slot(id);
+        if (slot.path.empty()) {
+            slot.path = path;  // Remember the source so the asset can be reloaded
+        }
+        if (slot.asset) {
+            stats.residentBytes -= slot.bytes;
+            --stats.residentAssets;
+        } else if (slot.evicted) {
+            ++stats.reloads;
+            slot.evicted = false;
+        }
+        slot.asset = std::move(asset);
+        slot.bytes = bytes;
+        slot.lastUsedFrame = frame;
+        stats.residentBytes += bytes;
+        ++stats.residentAssets;
+        ++stats.loads;
+    }
+
+    size_t fontBytes(StringId id, const std::string& path) const {
+        const AssetPack* pack = nullptr;
+        if (const AssetPack::Entry* entry = findInPacks(id, AssetPack::EntryType::Font, pack)) {
+            return static_cast<size_t>(entry->size);
+        }
+        std::error_code error;
+        auto size = std::filesystem::file_size(path, error);
+        return error ? 0 : static_cast<size_t>(size);
+    }
+
+    void adjustGroupPins(const std::string& group, int delta) {
+        auto it = groups.find(group);
+        if (it == groups.end()) return;
+
+        for (const auto& item : it->second) {
+            switch (item.kind) {
+                case AssetKind::Texture: textures.slot(item.id).pins += delta; break;
+                case AssetKind::Font:    fonts.slot(item.id).pins += delta; break;
+                case AssetKind::Sound:   soundBuffers.slot(item.id).pins += delta; break;
+                case AssetKind::Music:   break;
+            }
+        }
+    }
+
+    template<typename T>
+    void collectCandidates(const AssetTable<T>& table, AssetKind kind, std::vector<EvictionCandidate>& out) const {
+        for (std::uint32_t i = 0; i < table.slots.size(); ++i) {
+            const auto& slot = table.slots[i];
+            // Only evict what can be brought back
+            if (!slot.asset || slot.pins > 0 || slot.path.empty()) continue;
+
+            out.push_back({slot.lastUsedFrame, slot.bytes, static_cast<int>(kind), i});
+        }
+    }
+
+    template<typename T>
+    void evict(AssetTable<T>& table, std::uint32_t id) {
+        auto& slot = table.slots[id];
+        stats.residentBytes -= slot.bytes;
+        --stats.residentAssets;
+        ++stats.evictions;
+        slot.asset.reset();
+        slot.bytes = 0;
+        slot.evicted = true;
+    }
+
+    void enforceBudget() {
+        if (stats.budgetBytes == 0 || stats.residentBytes <= stats.budgetBytes) return;
+
+        std::vector<EvictionCandidate> candidates;
+        collectCandidates(textures, AssetKind::Texture, candidates);
+        collectCandidates(soundBuffers, AssetKind::Sound, candidates);
+
+        for (const auto& victim : selectEvictions(std::move(candidates), stats.residentBytes, stats.budgetBytes, frame)) {
+            if (victim.kind == static_cast<int>(AssetKind::Texture)) {
+                evict(textures, victim.id);
+            } else {
+                evict(soundBuffers, victim.id);
+            }
+        }
+    }
+
+    template<typename T>
+    bool loadRegistered(AssetTable<T>& table, StringId id, bool (AssetManager::*loader)(StringId, const std::string&)) {
+        if (id.value >= table.slots.size() || table.slots[id.value].path.empty()) return false;
+        std::string path = table.slots[id.value].path;
+        if ((this->*loader)(id, path)) return true;
+        table.slots[id.value].path.clear();  // Don't retry a broken asset every frame
+        return false;
+    }
+
+    bool isPacked(const PreloadItem& item) const {
+        AssetPack::EntryType type = item.kind == AssetKind::Texture ? AssetPack::EntryType::Texture
+                                  : item.kind == AssetKind::Sound ? AssetPack::EntryType::Sound
+                                  : AssetPack::EntryType::Font;
+        const AssetPack* owner = nullptr;
+        return findInPacks(item.id, type, owner) != nullptr;
+    }
+
+    const AssetPack::Entry* findInPacks(StringId id, AssetPack::EntryType type, const AssetPack*& owner) const {
+        for (auto it = packs.rbegin(); it != packs.rend(); ++it) {
+            const AssetPack::Entry* entry = (*it)->find(StringInterner::instance().str(id));
+            if (entry && entry->type == type) {
+                owner = it->get();
+                return entry;
+            }
+        }
+        return nullptr;
+    }
+
+    bool loadTextureFromPack(StringId id, sf::Texture& texture) const {
+        const AssetPack* pack = nullptr;
+        const AssetPack::Entry* entry = findInPacks(id, AssetPack::EntryType::Texture, pack);
+        if (!entry) return false;
+
+        if (!texture.resize({entry->width, entry->height})) {
+            std::cerr << "[AssetManager] Failed to create packed texture: "
+                      << StringInterner::instance().str(id) << "\n";
+            return false;
+        }
+        texture.update(pack->data(*entry));
+        return true;
+    }
+
+    bool loadFontFromPack(StringId id, sf::Font& font) const {
+        const AssetPack* pack = nullptr;
+        const AssetPack::Entry* entry = findInPacks(id, AssetPack::EntryType::Font, pack);
+        return entry && font.openFromMemory(pack->data(*entry), entry->size);
+    }
+
+    bool loadSoundBufferFromPack(StringId id, sf::SoundBuffer& buffer) const {
+        const AssetPack* pack = nullptr;
+        const AssetPack::Entry* entry = findInPacks(id, AssetPack::EntryType::Sound, pack);
+        if (!entry) return false;
+
+        std::vector<sf::SoundChannel> channelMap;
+        for (std::uint32_t i = 0; i < entry->width; ++i) {  // validate() caps width at the map size
+            channelMap.push_back(static_cast<sf::SoundChannel>(entry->channelMap[i]));
+        }
+        return buffer.loadFromSamples(reinterpret_cast<const std::int16_t*>(pack->data(*entry)),
+                                      entry->size / sizeof(std::int16_t),
+                                      entry->width, entry->height, channelMap);
+    }
+
     void createPlaceholderTexture() {
         placeholderTexture = std::make_unique<sf::Texture>();
         sf::Image img({32, 32}, sf::Color::Magenta);
@@ -119,12 +640,29 @@ private:
         }
     }
 
-    std::unordered_map<std::string, std::unique_ptr<sf::Texture>> textures;
-    std::unordered_map<std::string, std::unique_ptr<sf::Font>> fonts;
-    std::unordered_map<std::string, std::unique_ptr<sf::SoundBuffer>> soundBuffers;
+    // Declared first so mapped pack memory outlives the fonts reading from it
+    std::vector<std::unique_ptr<AssetPack>> packs;
+    AssetTable<sf::Texture> textures;
+    AssetTable<sf::Font> fonts;
+    AssetTable<sf::SoundBuffer> soundBuffers;
+    std::vector<std::string> musicPaths;  // By StringId
     std::unique_ptr<sf::Texture> placeholderTexture;
     sf::Font* defaultFont = nullptr;
 
+    // Preload groups (by name; only touched at state changes)
+    std::unordered_map<std::string, std::vector<PreloadItem>> groups;
+    std::vector<std::future<DecodedBatch>> pendingPreloads;
+    std::vector<std::string> pendingGroups;
+
+    // Residency
+    ResidencyStats stats;
+    std::uint64_t frame = 0;
+
+    // Hot reload; the watcher is declared last so its thread stops first
+    std::mutex reloadMutex;
+    std::vector<DecodedBatch> reloads;
+    AssetWatcher watcher;
+
     AssetManager(const AssetManager&) = delete;
     AssetManager& operator=(const AssetManager&) = delete;
 };
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <iostream>
+
+// Plain-text asset list shared by the offline packer and the runtime.
+//
+// One asset per line: "<kind> <id> <path>", e.g.
+//   font pixel assets/fonts/PressStart2P-Regular.ttf
+// A "[group]" line starts a preload group that the following entries belong
+// to, so a state can warm everything it needs in one call. Blank lines and
+// lines starting with '#' are ignored.
+enum class AssetKind { Texture, Font, Sound, Music };
+
+struct AssetManifestEntry {
+    AssetKind kind;
+    std::string id;
+    std::string path;
+    std::string group;  // Empty when declared before any [group] line
+};
+
+class AssetManifest {
+public:
+    bool loadFromFile(const std::string& path) {
+        std::ifstream file(path);
+        if (!file) {
+            std::cerr << "[AssetManifest] Failed to open manifest: " << path << "\n";
+            return false;
+        }
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        return parse(buffer.str());
+    }
+
+    bool parse(const std::string& text) {
+        entries.clear();
+
+        std::istringstream stream(text);
+        std::string line;
+        int lineNumber = 0;
+        bool ok = true;
+        std::string group;
+
+        while (std::getline(stream, line)) {
+            ++lineNumber;
+            std::istringstream fields(line);
+            std::string kindName, id, path;
+            if (!(fields >> kindName) || kindName[0] == '#') continue;
+
+            if (kindName.front() == '[' && kindName.back() == ']' && kindName.size() > 2) {
+                group = kindName.substr(1, kindName.size() - 2);
+                continue;
+            }
+
+            AssetKind kind;
+            if (!parseKind(kindName, kind) || !(fields >> id >> path)) {
+                std::cerr << "[AssetManifest] Malformed line " << lineNumber << ": " << line << "\n";
+                ok = false;
+                continue;
+            }
+            entries.push_back({kind, id, path, group});
+        }
+        return ok;
+    }
+
+    const std::vector<AssetManifestEntry>& getEntries() const { return entries; }
+
+    static bool parseKind(const std::string& name, AssetKind& out) {
+        if (name == "texture") { out = AssetKind::Texture; return true; }
+        if (name == "font")    { out = AssetKind::Font; return true; }
+        if (name == "sound")   { out = AssetKind::Sound; return true; }
+        if (name == "music")   { out = AssetKind::Music; return true; }
+        return false;
+    }
+
+private:
+    std::vector<AssetManifestEntry> entries;
+};
@@ -0,0 +1,333 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <iostream>
+
+#if defined(_WIN32)
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Packed asset archive (.pak).
+//
+// Layout (little-endian):
+//   Header | payloads (16-byte aligned) | id strings | hash table
+//
+// The hash table is an open-addressed array of Entry slots (power-of-two
+// size, linear probing) keyed on the FNV-1a hash of the asset id. Textures
+// are stored as decoded RGBA8, sounds as interleaved 16-bit PCM, and fonts and
+// music as the raw (still compressed) file, so mounting is a single mmap and
+// lookups touch only the pages they need.
+class AssetPack {
+public:
+    enum class EntryType : std::uint32_t { Texture = 1, Sound = 2, Font = 3, Music = 4 };
+
+    struct Header {
+        char magic[4];
+        std::uint32_t version;
+        std::uint32_t entryCount;
+        std::uint32_t tableSize;
+        std::uint64_t tableOffset;
+        std::uint64_t reserved;
+    };
+
+    struct Entry {
+        std::uint64_t hash;          // 0 marks an empty slot
+        std::uint64_t offset;
+        std::uint64_t size;
+        std::uint64_t idOffset;
+        std::uint32_t idLength;
+        EntryType type;
+        std::uint32_t width;         // Texture: width, Sound: channel count
+        std::uint32_t height;        // Texture: height, Sound: sample rate
+        std::uint8_t channelMap[8];  // Sound: sf::SoundChannel per channel
+        std::uint64_t reserved;
+    };
+
+    static_assert(sizeof(Header) == 32, "AssetPack header layout changed");
+    static_assert(sizeof(Entry) == 64, "AssetPack entry layout changed");
+
+    static constexpr char MAGIC[4] = {'D', 'C', 'P', 'K'};
+    static constexpr std::uint32_t VERSION = 1;
+
+    AssetPack() = default;
+    ~AssetPack() { close(); }
+
+    AssetPack(const AssetPack&) = delete;
+    AssetPack& operator=(const AssetPack&) = delete;
+
+    bool open(const std::string& path) {
+        close();
+        if (!mapFile(path)) {
+            std::cerr << "[AssetPack] Failed to map pack: " << path << "\n";
+            return false;
+        }
+        if (!validate()) {
+            std::cerr << "[AssetPack] Invalid or corrupt pack: " << path << "\n";
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    void close() {
+#if !defined(_WIN32)
+        if (mapping) {
+            munmap(const_cast<std::uint8_t*>(mapping), mappingSize);
+        }
+#endif
+        mapping = nullptr;
+        mappingSize = 0;
+        fallback.clear();
+        fallback.shrink_to_fit();
+        header = nullptr;
+        table = nullptr;
+    }
+
+    bool isOpen() const { return header != nullptr; }
+    std::uint32_t count() const { return header ? header->entryCount : 0; }
+
+    const Entry* find(std::string_view id) const {
+        if (!header) return nullptr;
+
+        std::uint64_t hash = hashId(id);
+        std::uint32_t mask = header->tableSize - 1;
+        std::uint32_t i = static_cast<std::uint32_t>(hash) & mask;
+        for (std::uint32_t probes = 0; probes < header->tableSize; ++probes, i = (i + 1) & mask) {
+            const Entry& entry = table[i];
+            if (entry.hash == 0) return nullptr;
+            if (entry.hash == hash && idOf(entry) == id) return &entry;
+        }
+        return nullptr;
+    }
+
+    const std::uint8_t* data(const Entry& entry) const {
+        return mapping + entry.offset;
+    }
+
+    std::string_view idOf(const Entry& entry) const {
+        return {reinterpret_cast<const char*>(mapping + entry.idOffset), entry.idLength};
+    }
+
+    // FNV-1a, with 0 reserved for empty table slots
+    static std::uint64_t hashId(std::string_view id) {
+        std::uint64_t hash = 14695981039346656037ull;
+        for (char c : id) {
+            hash ^= static_cast<std::uint8_t>(c);
+            hash *= 1099511628211ull;
+        }
+        return hash != 0 ? hash : 1;
+    }
+
+private:
+    bool mapFile(const std::string& path) {
+#if defined(_WIN32)
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file) return false;
+        fallback.resize(static_cast<size_t>(file.tellg()));
+        file.seekg(0);
+        if (!file.read(reinterpret_cast<char*>(fallback.data()), fallback.size())) return false;
+        mapping = fallback.data();
+        mappingSize = fallback.size();
+        return true;
+#else
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+
+        struct stat info {};
+        if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+            ::close(fd);
+            return false;
+        }
+
+        void* addr = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);  // The mapping keeps its own reference to the file
+        if (addr == MAP_FAILED) return false;
+
+        mapping = static_cast<const std::uint8_t*>(addr);
+        mappingSize = static_cast<size_t>(info.st_size);
+        return true;
+#endif
+    }
+
+    bool validate() {
+        if (mappingSize < sizeof(Header)) return false;
+
+        header = reinterpret_cast<const Header*>(mapping);
+        if (std::memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0 || header->version != VERSION) return false;
+
+        std::uint32_t slots = header->tableSize;
+        if (slots == 0 || (slots & (slots - 1)) != 0 || header->entryCount >= slots) return false;
+        if (header->tableOffset % alignof(Entry) != 0 ||
+            header->tableOffset > mappingSize ||
+            mappingSize - header->tableOffset < static_cast<std::uint64_t>(slots) * sizeof(Entry)) {
+            return false;
+        }
+        table = reinterpret_cast<const Entry*>(mapping + header->tableOffset);
+
+        // entryCount is only the header's claim; probing relies on a real
+        // empty slot, texture uploads on the payload matching its size, and
+        // sound loads on whole, aligned samples and a channel map per channel
+        std::uint32_t emptySlots = 0;
+        for (std::uint32_t i = 0; i < slots; ++i) {
+            const Entry& entry = table[i];
+            if (entry.hash == 0) {
+                ++emptySlots;
+                continue;
+            }
+            if (entry.offset > mappingSize || mappingSize - entry.offset < entry.size) return false;
+            if (entry.idOffset > mappingSize || mappingSize - entry.idOffset < entry.idLength) return false;
+            if (entry.type == EntryType::Texture &&
+                entry.size != static_cast<std::uint64_t>(entry.width) * entry.height * 4) {
+                return false;
+            }
+            if (entry.type == EntryType::Sound &&
+                (entry.offset % alignof(std::int16_t) != 0 || entry.size % sizeof(std::int16_t) != 0 ||
+                 entry.width < 1 || entry.width > sizeof(entry.channelMap) || entry.height == 0)) {
+                return false;
+            }
+        }
+        return emptySlots > 0;
+    }
+
+    const std::uint8_t* mapping = nullptr;
+    size_t mappingSize = 0;
+    std::vector<std::uint8_t> fallback;  // Used where mmap is unavailable
+    const Header* header = nullptr;
+    const Entry* table = nullptr;
+};
+
+// Builds .pak files. Used by the offline AssetPacker tool; decoding of source
+// files happens there so this stays free of SFML.
+class AssetPackWriter {
+public:
+    void addTexture(const std::string& id, std::uint32_t width, std::uint32_t height, const std::uint8_t* rgba) {
+        auto& entry = add(id, AssetPack::EntryType::Texture, rgba, static_cast<size_t>(width) * height * 4);
+        entry.width = width;
+        entry.height = height;
+    }
+
+    void addSound(const std::string& id, const std::int16_t* samples, std::uint64_t sampleCount,
+                  std::uint32_t channelCount, std::uint32_t sampleRate,
+                  const std::vector<std::uint8_t>& channelMap) {
+        auto& entry = add(id, AssetPack::EntryType::Sound, samples, sampleCount * sizeof(std::int16_t));
+        entry.width = channelCount;
+        entry.height = sampleRate;
+        for (size_t i = 0; i < channelMap.size() && i < sizeof(entry.channelMap); ++i) {
+            entry.channelMap[i] = channelMap[i];
+        }
+    }
+
+    void addFont(const std::string& id, const std::uint8_t* bytes, size_t size) {
+        add(id, AssetPack::EntryType::Font, bytes, size);
+    }
+
+    void addMusic(const std::string& id, const std::uint8_t* bytes, size_t size) {
+        add(id, AssetPack::EntryType::Music, bytes, size);
+    }
+
+    bool write(const std::string& path) const {
+        std::uint32_t slots = 1;
+        while (slots < pending.size() * 2 + 1) slots <<= 1;
+
+        // Payloads first, then ids, then the table
+        std::vector<std::uint8_t> out(sizeof(AssetPack::Header));
+        std::vector<AssetPack::Entry> entries;
+        entries.reserve(pending.size());
+
+        for (const auto& item : pending) {
+            align(out, 16);
+            AssetPack::Entry entry = item.entry;
+            entry.offset = out.size();
+            entry.size = item.payload.size();
+            out.insert(out.end(), item.payload.begin(), item.payload.end());
+            entries.push_back(entry);
+        }
+        for (size_t i = 0; i < pending.size(); ++i) {
+            entries[i].idOffset = out.size();
+            entries[i].idLength = static_cast<std::uint32_t>(pending[i].id.size());
+            out.insert(out.end(), pending[i].id.begin(), pending[i].id.end());
+        }
+
+        std::vector<AssetPack::Entry> table(slots);
+        std::memset(table.data(), 0, table.size() * sizeof(AssetPack::Entry));
+        for (const auto& entry : entries) {
+            std::uint32_t mask = slots - 1;
+            std::uint32_t i = static_cast<std::uint32_t>(entry.hash) & mask;
+            while (table[i].hash != 0) i = (i + 1) & mask;
+            table[i] = entry;
+        }
+
+        align(out, alignof(AssetPack::Entry));
+        AssetPack::Header header{};
+        std::memcpy(header.magic, AssetPack::MAGIC, sizeof(header.magic));
+        header.version = AssetPack::VERSION;
+        header.entryCount = static_cast<std::uint32_t>(entries.size());
+        header.tableSize = slots;
+        header.tableOffset = out.size();
+
+        const auto* tableBytes = reinterpret_cast<const std::uint8_t*>(table.data());
+        out.insert(out.end(), tableBytes, tableBytes + table.size() * sizeof(AssetPack::Entry));
+        std::memcpy(out.data(), &header, sizeof(header));
+
+        std::FILE* file = std::fopen(path.c_str(), "wb");
+        if (!file) {
+            std::cerr << "[AssetPackWriter] Failed to open for writing: " << path << "\n";
+            return false;
+        }
+        bool ok = std::fwrite(out.data(), 1, out.size(), file) == out.size();
+        ok = std::fclose(file) == 0 && ok;
+        return ok;
+    }
+
+    size_t count() const { return pending.size(); }
+
+private:
+    struct Pending {
+        std::string id;
+        AssetPack::Entry entry;
+        std::vector<std::uint8_t> payload;
+    };
+
+    AssetPack::Entry& add(const std::string& id, AssetPack::EntryType type, const void* bytes, size_t size) {
+        // Re-adding an id replaces the earlier payload
+        for (auto& item : pending) {
+            if (item.id == id) {
+                item.entry = makeEntry(id, type);
+                item.payload.assign(static_cast<const std::uint8_t*>(bytes),
+                                    static_cast<const std::uint8_t*>(bytes) + size);
+                return item.entry;
+            }
+        }
+        Pending item;
+        item.id = id;
+        item.entry = makeEntry(id, type);
+        item.payload.assign(static_cast<const std::uint8_t*>(bytes),
+                            static_cast<const std::uint8_t*>(bytes) + size);
+        pending.push_back(std::move(item));
+        return pending.back().entry;
+    }
+
+    static AssetPack::Entry makeEntry(const std::string& id, AssetPack::EntryType type) {
+        AssetPack::Entry entry;
+        std::memset(&entry, 0, sizeof(entry));
+        entry.hash = AssetPack::hashId(id);
+        entry.type = type;
+        return entry;
+    }
+
+    static void align(std::vector<std::uint8_t>& out, size_t alignment) {
+        out.resize((out.size() + alignment - 1) / alignment * alignment, 0);
+    }
+
+    std::vector<Pending> pending;
+};
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Residency bookkeeping for AssetManager's memory budget.
+
+struct ResidencyStats {
+    size_t budgetBytes = 0;     // 0 means unlimited
+    size_t residentBytes = 0;
+    size_t residentAssets = 0;
+    size_t loads = 0;           // Every successful load, including reloads
+    size_t reloads = 0;         // Loads of an asset that had been evicted
+    size_t evictions = 0;
+};
+
+// An asset that could be dropped to get back under budget
+struct EvictionCandidate {
+    std::uint64_t lastUsedFrame;
+    size_t bytes;
+    int kind;           // Caller-defined asset kind
+    std::uint32_t id;   // Caller-defined id within that kind
+};
+
+// Picks least-recently-used candidates until residentBytes fits the budget.
+// Assets used during the previous frame are never picked, since callers may
+// still hold references from it; the budget is allowed to overshoot instead
+// of thrashing assets that are in active use.
+inline std::vector<EvictionCandidate> selectEvictions(std::vector<EvictionCandidate> candidates,
+                                                      size_t residentBytes, size_t budgetBytes,
+                                                      std::uint64_t currentFrame) {
+    std::vector<EvictionCandidate> victims;
+    if (budgetBytes == 0 || residentBytes <= budgetBytes) return victims;
+
+    std::sort(candidates.begin(), candidates.end(),
+        [](const EvictionCandidate& a, const EvictionCandidate& b) {
+            return a.lastUsedFrame < b.lastUsedFrame;
+        });
+
+    for (const auto& candidate : candidates) {
+        if (residentBytes <= budgetBytes) break;
+        if (candidate.lastUsedFrame + 1 >= currentFrame) break;  // Sorted: the rest are newer
+        victims.push_back(candidate);
+        residentBytes -= std::min(residentBytes, candidate.bytes);
+    }
+    return victims;
+}
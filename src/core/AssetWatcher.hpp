@@ -0,0 +1,132 @@
+#pragma once
+
+#include <atomic>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+// Watches a set of files for changes on a background thread and calls
+// onChanged (on that thread) with the path as it was passed to start().
+//
+// Directories are watched rather than files, so editors that save by
+// writing a temp file and renaming it over the original are picked up too.
+// Only implemented on Linux (inotify); start() returns false elsewhere.
+class AssetWatcher {
+public:
+    using Callback = std::function<void(const std::string& path)>;
+
+    AssetWatcher() = default;
+    ~AssetWatcher() { stop(); }
+
+    AssetWatcher(const AssetWatcher&) = delete;
+    AssetWatcher& operator=(const AssetWatcher&) = delete;
+
+    bool start(const std::vector<std::string>& paths, Callback onChanged) {
+        stop();
+#if defined(__linux__)
+        fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (fd < 0) {
+            std::cerr << "[AssetWatcher] inotify_init1 failed\n";
+            return false;
+        }
+
+        for (const auto& path : paths) {
+            std::filesystem::path normal = std::filesystem::path(path).lexically_normal();
+            std::string dir = normal.has_parent_path() ? normal.parent_path().string() : ".";
+
+            if (watchedDirs.find(dir) == watchedDirs.end()) {
+                int wd = inotify_add_watch(fd, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+                if (wd < 0) {
+                    std::cerr << "[AssetWatcher] Cannot watch directory: " << dir << "\n";
+                    continue;
+                }
+                watchedDirs[dir] = wd;
+                dirsByWatch[wd] = dir;
+            }
+            watchedFiles[(std::filesystem::path(dir) / normal.filename()).string()] = path;
+        }
+
+        running = true;
+        worker = std::thread([this, onChanged = std::move(onChanged)]() { run(onChanged); });
+        return true;
+#else
+        (void)paths;
+        (void)onChanged;
+        std::cerr << "[AssetWatcher] Hot reload is only supported on Linux\n";
+        return false;
+#endif
+    }
+
+    void stop() {
+        running = false;
+        if (worker.joinable()) {
+            worker.join();
+        }
+#if defined(__linux__)
+        if (fd >= 0) {
+            ::close(fd);  // Also drops every watch
+            fd = -1;
+        }
+#endif
+        watchedDirs.clear();
+        dirsByWatch.clear();
+        watchedFiles.clear();
+    }
+
+    bool isRunning() const { return running; }
+
+private:
+#if defined(__linux__)
+    void run(const Callback& onChanged) {
+        alignas(inotify_event) char buffer[4096];
+
+        while (running) {
+            pollfd pfd{fd, POLLIN, 0};
+            if (poll(&pfd, 1, POLL_INTERVAL_MS) <= 0) continue;
+
+            // Coalesce the burst of events a single save tends to produce
+            std::set<std::string> changed;
+            ssize_t length;
+            while ((length = read(fd, buffer, sizeof(buffer))) > 0) {
+                for (char* ptr = buffer; ptr < buffer + length;) {
+                    auto* event = reinterpret_cast<inotify_event*>(ptr);
+                    ptr += sizeof(inotify_event) + event->len;
+
+                    auto dir = dirsByWatch.find(event->wd);
+                    if (dir == dirsByWatch.end() || event->len == 0) continue;
+
+                    auto file = watchedFiles.find((std::filesystem::path(dir->second) / event->name).string());
+                    if (file != watchedFiles.end()) {
+                        changed.insert(file->second);
+                    }
+                }
+            }
+
+            for (const auto& path : changed) {
+                onChanged(path);
+            }
+        }
+    }
+
+    static constexpr int POLL_INTERVAL_MS = 100;
+
+    int fd = -1;
+#endif
+
+    std::atomic<bool> running{false};
+    std::thread worker;
+    std::map<std::string, int> watchedDirs;
+    std::map<int, std::string> dirsByWatch;
+    std::map<std::string, std::string> watchedFiles;  // Normalized -> as registered
+};
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <unordered_map>
 #include <vector>
@@ -90,3 +91,8 @@ struct RoomEnteredEvent {
 struct FloorCompletedEvent {
     int floorNumber;
 };
+
+// A hot reload replaced the samples of a resident sound buffer
+struct SoundReloadedEvent {
+    std::uint32_t bufferId;  // StringId value
+};
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+// Compact handle for an interned string. Ids are dense (0, 1, 2, ...) so they
+// can index arrays directly; 0 is always the empty string.
+struct StringId {
+    std::uint32_t value = 0;
+
+    bool empty() const { return value == 0; }
+
+    bool operator==(const StringId& other) const { return value == other.value; }
+    bool operator!=(const StringId& other) const { return value != other.value; }
+};
+
+// Process-wide string table. Interning takes a lock, so do it at load or
+// spawn time and keep the resulting StringId on the per-frame path.
+class StringInterner {
+public:
+    static StringInterner& instance() {
+        static StringInterner inst;
+        return inst;
+    }
+
+    StringId intern(std::string_view text) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = lookup.find(text);
+        if (it != lookup.end()) {
+            return StringId{it->second};
+        }
+        // Deque elements never move, so the map can key on views into them
+        const std::string& stored = strings.emplace_back(text);
+        auto id = static_cast<std::uint32_t>(strings.size() - 1);
+        lookup.emplace(stored, id);
+        return StringId{id};
+    }
+
+    const std::string& str(StringId id) const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return id.value < strings.size() ? strings[id.value] : strings[0];
+    }
+
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return strings.size();
+    }
+
+private:
+    StringInterner() {
+        strings.emplace_back();
+        lookup.emplace(strings[0], 0);
+    }
+
+    mutable std::mutex mutex;
+    std::deque<std::string> strings;
+    std::unordered_map<std::string_view, std::uint32_t> lookup;
+
+    StringInterner(const StringInterner&) = delete;
+    StringInterner& operator=(const StringInterner&) = delete;
+};
+
+inline StringId intern(std::string_view text) {
+    return StringInterner::instance().intern(text);
+}
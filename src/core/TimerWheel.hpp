@@ -0,0 +1,225 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+// Hierarchical timing wheel for gameplay countdowns.
+//
+// Time advances in fixed ticks (TICK_RATE per second). Each level is a ring
+// of 64 slots; level 0 slots are single ticks, level 1 slots span 64 ticks,
+// level 2 span 64^2 and so on. A timer sits in the coarsest level its
+// deadline needs and drops a level each time the wheel below it wraps, so
+// scheduling, cancelling and firing are all O(1) and a tick with nothing
+// due costs next to nothing, however many timers are pending.
+class TimerWheel {
+public:
+    using Callback = std::function<void()>;
+
+    struct Handle {
+        std::uint32_t index = 0;
+        std::uint32_t generation = 0;  // 0 never matches a live timer
+    };
+
+    static constexpr int TICK_RATE = 120;
+    static constexpr float TICK = 1.f / TICK_RATE;
+
+    // Runs onExpired once `seconds` of game time have passed, rounded up to
+    // whole ticks (never early, and at least one tick)
+    Handle schedule(float seconds, Callback onExpired = {}) {
+        std::uint64_t ticks = toTicks(seconds);
+        std::uint32_t index = allocate();
+        Node& node = nodes[index];
+        node.deadline = now + ticks;
+        node.callback = std::move(onExpired);
+        insert(index);
+        ++pendingCount;
+        return {index, node.generation};
+    }
+
+    // False if the timer already fired or was cancelled
+    bool cancel(Handle handle) {
+        if (!isPending(handle)) return false;
+        unlink(handle.index);
+        release(handle.index);
+        return true;
+    }
+
+    bool isPending(Handle handle) const {
+        return handle.index < nodes.size() && handle.generation != 0 &&
+               nodes[handle.index].generation == handle.generation && nodes[handle.index].slot != nullptr;
+    }
+
+    // Seconds until the timer fires; 0 if it is not pending
+    float remaining(Handle handle) const {
+        if (!isPending(handle)) return 0.f;
+        float seconds = static_cast<float>(nodes[handle.index].deadline - now) * TICK - carry;
+        return std::max(seconds, 0.f);
+    }
+
+    // Moves game time forward, firing everything that comes due in order
+    void advance(float dt) {
+        carry += dt;
+        while (carry >= TICK) {
+            carry -= TICK;
+            tick();
+        }
+    }
+
+    // Drops every pending timer without firing it
+    void clear() {
+        for (std::uint32_t i = 0; i < nodes.size(); ++i) {
+            if (nodes[i].slot) release(i);
+        }
+        for (auto& level : levels) level.fill(NONE);
+        carry = 0.f;
+    }
+
+    size_t pending() const { return pendingCount; }
+    std::uint64_t getTick() const { return now; }
+
+    // The delay schedule() uses for a duration, for callers that keep their
+    // own deadlines in ticks
+    static std::uint64_t toTicks(float seconds) {
+        std::uint64_t ticks = static_cast<std::uint64_t>(std::max(std::ceil(seconds * TICK_RATE - ROUNDING_SLACK), 1.f));
+        return std::min<std::uint64_t>(ticks, MAX_DELAY);
+    }
+
+private:
+    static constexpr int SLOT_BITS = 6;
+    static constexpr int SLOTS = 1 << SLOT_BITS;
+    static constexpr int LEVELS = 4;
+    static constexpr std::uint64_t MAX_DELAY = (std::uint64_t{1} << (SLOT_BITS * LEVELS)) - 1;  // ~39 hours
+    static constexpr float ROUNDING_SLACK = 1e-3f;  // So 0.15s is 18 ticks, not 19
+    static constexpr std::uint32_t NONE = 0xFFFFFFFF;
+
+    struct Node {
+        std::uint64_t deadline = 0;
+        std::uint32_t generation = 1;
+        std::uint32_t prev = NONE, next = NONE;
+        std::uint32_t* slot = nullptr;  // List head this node is in; null when free
+        Callback callback;
+    };
+
+    void tick() {
+        ++now;
+
+        // Cascade coarser slots whose span starts now, coarsest first so a
+        // timer can fall more than one level in a single tick
+        for (int level = LEVELS - 1; level >= 1; --level) {
+            std::uint64_t span = std::uint64_t{1} << (SLOT_BITS * level);
+            if (now % span != 0) continue;
+            std::uint32_t& head = levels[level][(now >> (SLOT_BITS * level)) & (SLOTS - 1)];
+            std::uint32_t index = head;
+            head = NONE;
+            while (index != NONE) {
+                std::uint32_t next = nodes[index].next;
+                nodes[index].slot = nullptr;
+                insert(index);
+                index = next;
+            }
+        }
+
+        // Everything in the current level-0 slot is due now. Callbacks may
+        // schedule or cancel timers, but new ones never land in this slot.
+        std::uint32_t& head = levels[0][now & (SLOTS - 1)];
+        while (head != NONE) {
+            std::uint32_t index = head;
+            unlink(index);
+            Callback callback = std::move(nodes[index].callback);
+            release(index);
+            if (callback) callback();
+        }
+    }
+
+    void insert(std::uint32_t index) {
+        Node& node = nodes[index];
+        std::uint64_t delta = node.deadline > now ? node.deadline - now : 0;
+
+        int level = 0;
+        while (level < LEVELS - 1 && delta >= (std::uint64_t{1} << (SLOT_BITS * (level + 1)))) ++level;
+
+        std::uint32_t& head = levels[level][(node.deadline >> (SLOT_BITS * level)) & (SLOTS - 1)];
+        node.prev = NONE;
+        node.next = head;
+        if (head != NONE) nodes[head].prev = index;
+        head = index;
+        node.slot = &head;
+    }
+
+    void unlink(std::uint32_t index) {
+        Node& node = nodes[index];
+        if (node.prev != NONE) {
+            nodes[node.prev].next = node.next;
+        } else {
+            *node.slot = node.next;
+        }
+        if (node.next != NONE) nodes[node.next].prev = node.prev;
+        node.slot = nullptr;
+    }
+
+    std::uint32_t allocate() {
+        if (!freeList.empty()) {
+            std::uint32_t index = freeList.back();
+            freeList.pop_back();
+            return index;
+        }
+        nodes.emplace_back();
+        return static_cast<std::uint32_t>(nodes.size() - 1);
+    }
+
+    // Bumping the generation invalidates every handle to the old timer
+    void release(std::uint32_t index) {
+        Node& node = nodes[index];
+        node.slot = nullptr;
+        node.callback = nullptr;
+        if (++node.generation == 0) node.generation = 1;
+        freeList.push_back(index);
+        --pendingCount;
+    }
+
+    std::array<std::array<std::uint32_t, SLOTS>, LEVELS> levels = makeLevels();
+    std::vector<Node> nodes;
+    std::vector<std::uint32_t> freeList;
+    std::uint64_t now = 0;
+    float carry = 0.f;  // Game time not yet turned into a tick
+    size_t pendingCount = 0;
+
+    static std::array<std::array<std::uint32_t, SLOTS>, LEVELS> makeLevels() {
+        std::array<std::array<std::uint32_t, SLOTS>, LEVELS> result;
+        for (auto& level : result) level.fill(NONE);
+        return result;
+    }
+};
+
+// A component-owned countdown on a TimerWheel. Cancels itself when stopped,
+// restarted or destroyed, so a callback never outlives its owner.
+class Timer {
+public:
+    Timer() = default;
+    ~Timer() { stop(); }
+
+    Timer(const Timer&) = delete;
+    Timer& operator=(const Timer&) = delete;
+
+    void start(TimerWheel& timers, float seconds, TimerWheel::Callback onExpired = {}) {
+        stop();
+        wheel = &timers;
+        handle = timers.schedule(seconds, std::move(onExpired));
+    }
+
+    void stop() {
+        if (wheel) wheel->cancel(handle);
+        wheel = nullptr;
+    }
+
+    bool isPending() const { return wheel && wheel->isPending(handle); }
+    float remaining() const { return wheel ? wheel->remaining(handle) : 0.f; }
+
+private:
+    TimerWheel* wheel = nullptr;
+    TimerWheel::Handle handle;
+};
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// Batched AI decision inputs and outputs in structure-of-arrays form, so the
+// per-agent chase test and steering run as one tight loop (8 agents per
+// instruction with AVX2) instead of being interleaved with component lookups.
+struct AIBatch {
+    // Inputs
+    std::vector<float> posX, posY;
+    std::vector<float> detectRadius2, loseRadius2;  // Squared
+    std::vector<float> chaseSpeed;
+    // In: current state; out: state after this decision
+    std::vector<std::uint8_t> chasing;
+    std::vector<float> velX, velY;
+    // Out
+    std::vector<float> distance2;  // To the player, squared
+
+    size_t size() const { return posX.size(); }
+
+    void clear() {
+        posX.clear(); posY.clear();
+        detectRadius2.clear(); loseRadius2.clear();
+        chaseSpeed.clear();
+        chasing.clear();
+        velX.clear(); velY.clear();
+        distance2.clear();
+    }
+
+    void push(sf::Vector2f position, float detectRadius, float loseRadius, float speed,
+              bool isChasing, sf::Vector2f velocity) {
+        posX.push_back(position.x);
+        posY.push_back(position.y);
+        detectRadius2.push_back(detectRadius * detectRadius);
+        loseRadius2.push_back(loseRadius * loseRadius);
+        chaseSpeed.push_back(speed);
+        chasing.push_back(isChasing ? 1 : 0);
+        velX.push_back(velocity.x);
+        velY.push_back(velocity.y);
+        distance2.push_back(0.f);
+    }
+};
+
+// Chase/lose transitions and chase steering for agents [begin, end).
+// Agents that end up chasing get a velocity of chaseSpeed toward the player
+// (unchanged if they sit exactly on it); other velocities are left alone.
+inline void runAIKernelScalar(AIBatch& batch, sf::Vector2f player, size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+        float dx = player.x - batch.posX[i];
+        float dy = player.y - batch.posY[i];
+        float d2 = dx * dx + dy * dy;
+        batch.distance2[i] = d2;
+
+        if (d2 < batch.detectRadius2[i]) {
+            batch.chasing[i] = 1;
+        } else if (d2 > batch.loseRadius2[i]) {
+            batch.chasing[i] = 0;
+        }
+
+        if (batch.chasing[i] && d2 > 0.f) {
+            float length = std::sqrt(d2);
+            batch.velX[i] = dx / length * batch.chaseSpeed[i];
+            batch.velY[i] = dy / length * batch.chaseSpeed[i];
+        }
+    }
+}
+
+inline void runAIKernelScalar(AIBatch& batch, sf::Vector2f player) {
+    runAIKernelScalar(batch, player, 0, batch.size());
+}
+
+#if defined(__AVX2__)
+// Matches the scalar kernel: sqrt and division are exactly rounded in both,
+// so no reciprocal approximations are used.
+inline void runAIKernelAvx2(AIBatch& batch, sf::Vector2f player) {
+    const size_t count = batch.size();
+    const size_t vectorEnd = count - count % 8;
+    const __m256 px = _mm256_set1_ps(player.x);
+    const __m256 py = _mm256_set1_ps(player.y);
+    const __m256 zero = _mm256_setzero_ps();
+
+    for (size_t i = 0; i < vectorEnd; i += 8) {
+        __m256 dx = _mm256_sub_ps(px, _mm256_loadu_ps(&batch.posX[i]));
+        __m256 dy = _mm256_sub_ps(py, _mm256_loadu_ps(&batch.posY[i]));
+        __m256 d2 = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+        _mm256_storeu_ps(&batch.distance2[i], d2);
+
+        // Widen the 8 chase flags to a lane mask
+        __m128i flags = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(&batch.chasing[i]));
+        __m256 wasChasing = _mm256_castsi256_ps(
+            _mm256_cmpgt_epi32(_mm256_cvtepu8_epi32(flags), _mm256_setzero_si256()));
+
+        __m256 enter = _mm256_cmp_ps(d2, _mm256_loadu_ps(&batch.detectRadius2[i]), _CMP_LT_OQ);
+        __m256 leave = _mm256_cmp_ps(d2, _mm256_loadu_ps(&batch.loseRadius2[i]), _CMP_GT_OQ);
+        __m256 chasing = _mm256_or_ps(enter, _mm256_andnot_ps(leave, wasChasing));
+
+        int bits = _mm256_movemask_ps(chasing);
+        for (int lane = 0; lane < 8; ++lane) {
+            batch.chasing[i + lane] = static_cast<std::uint8_t>((bits >> lane) & 1);
+        }
+
+        __m256 steer = _mm256_and_ps(chasing, _mm256_cmp_ps(d2, zero, _CMP_GT_OQ));
+        __m256 length = _mm256_sqrt_ps(d2);
+        __m256 speed = _mm256_loadu_ps(&batch.chaseSpeed[i]);
+        __m256 vx = _mm256_mul_ps(_mm256_div_ps(dx, length), speed);
+        __m256 vy = _mm256_mul_ps(_mm256_div_ps(dy, length), speed);
+        _mm256_storeu_ps(&batch.velX[i], _mm256_blendv_ps(_mm256_loadu_ps(&batch.velX[i]), vx, steer));
+        _mm256_storeu_ps(&batch.velY[i], _mm256_blendv_ps(_mm256_loadu_ps(&batch.velY[i]), vy, steer));
+    }
+
+    runAIKernelScalar(batch, player, vectorEnd, count);
+}
+#endif
+
+// Uses the AVX2 kernel when the build enables it (ENABLE_AVX2 in CMake)
+inline void runAIKernel(AIBatch& batch, sf::Vector2f player) {
+#if defined(__AVX2__)
+    runAIKernelAvx2(batch, player);
+#else
+    runAIKernelScalar(batch, player);
+#endif
+}
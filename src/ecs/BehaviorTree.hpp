@@ -0,0 +1,347 @@
+#pragma once
+
+#include "Component.hpp"
+#include "AIKernel.hpp"
+#include "../util/Random.hpp"
+#include <SFML/Graphics.hpp>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+enum class BTOp : std::uint8_t {
+    // Composites
+    Selector, Sequence, Invert,
+    // Conditions
+    Chasing, TimerDone, Chance, PlayerWithin,
+    // Actions
+    Chase, Flee, Wander, Stop, SetTimer, Succeed,
+};
+
+struct BTNode {
+    BTOp op;
+    std::uint8_t slot = 0;   // Blackboard slot for timer nodes
+    std::uint16_t end = 0;   // One past the last node of this subtree
+    float param = -1.f;      // Node argument; negative when omitted
+};
+
+// A compiled tree: nodes in preorder, so a node's children follow it and
+// each child's `end` is where its next sibling starts. Walking a tree is a
+// scan over one small array with no pointers to chase.
+struct BehaviorTree {
+    std::string name;
+    std::vector<BTNode> nodes;       // nodes[0] is the root
+    std::vector<std::string> slots;  // Blackboard slot names, by index
+};
+
+// What one agent's decision can read and write
+struct BTContext {
+    AIComponent& ai;
+    PhysicsComponent& physics;
+    const AIBatch& batch;  // Perception from the AI kernel
+    size_t index;          // This agent's entry in batch
+    sf::Vector2f playerPos;
+    util::Pcg32& rng;
+};
+
+inline bool runBehavior(const std::vector<BTNode>& nodes, std::uint16_t i, BTContext& ctx) {
+    const BTNode& node = nodes[i];
+    switch (node.op) {
+        case BTOp::Selector:
+            for (std::uint16_t child = i + 1; child < node.end; child = nodes[child].end) {
+                if (runBehavior(nodes, child, ctx)) return true;
+            }
+            return false;
+
+        case BTOp::Sequence:
+            for (std::uint16_t child = i + 1; child < node.end; child = nodes[child].end) {
+                if (!runBehavior(nodes, child, ctx)) return false;
+            }
+            return true;
+
+        case BTOp::Invert:
+            return !runBehavior(nodes, i + 1, ctx);
+
+        case BTOp::Chasing:
+            return ctx.batch.chasing[ctx.index] != 0;
+
+        case BTOp::TimerDone:
+            return ctx.ai.blackboard[node.slot] <= 0.f;
+
+        case BTOp::Chance:
+            return ctx.rng.nextChance(node.param);
+
+        case BTOp::PlayerWithin:
+            return ctx.batch.distance2[ctx.index] < node.param * node.param;
+
+        case BTOp::Chase:
+        case BTOp::Flee: {
+            float d2 = ctx.batch.distance2[ctx.index];
+            if (d2 <= 0.f) return true;  // On top of the player: keep going
+            sf::Vector2f velocity;
+            if (ctx.batch.chasing[ctx.index]) {
+                velocity = {ctx.batch.velX[ctx.index], ctx.batch.velY[ctx.index]};  // Steered by the kernel
+            } else {
+                sf::Vector2f dir{ctx.playerPos.x - ctx.batch.posX[ctx.index], ctx.playerPos.y - ctx.batch.posY[ctx.index]};
+                velocity = dir / std::sqrt(d2) * ctx.ai.chaseSpeed;
+            }
+            ctx.physics.velocity = node.op == BTOp::Chase ? velocity : -velocity;
+            return true;
+        }
+
+        case BTOp::Wander: {
+            float angle = ctx.rng.nextFloat(0.f, 2.f * 3.14159f);
+            ctx.physics.velocity.x = std::cos(angle) * ctx.ai.wanderSpeed;
+            ctx.physics.velocity.y = std::sin(angle) * ctx.ai.wanderSpeed;
+            return true;
+        }
+
+        case BTOp::Stop:
+            ctx.physics.velocity = {0.f, 0.f};
+            return true;
+
+        case BTOp::SetTimer: {
+            // Somewhere in [seconds, 2 * seconds), so agents drift out of step
+            float seconds = node.param >= 0.f ? node.param : ctx.ai.directionChangeInterval;
+            ctx.ai.blackboard[node.slot] = seconds + ctx.rng.nextFloat(0.f, seconds);
+            return true;
+        }
+
+        case BTOp::Succeed:
+            return true;
+    }
+    return false;
+}
+
+inline bool runBehavior(const BehaviorTree& tree, BTContext& ctx) {
+    return !tree.nodes.empty() && runBehavior(tree.nodes, 0, ctx);
+}
+
+// Loads behavior trees from a text file and compiles them to node arrays:
+//
+//   [slime]
+//   selector                  <- indentation nests nodes
+//     sequence
+//       chasing
+//       chase
+//     sequence
+//       timer_done wander     <- "wander" names a blackboard slot
+//       wander
+//       set_timer wander 1.0
+//     succeed
+//
+// Composites: selector, sequence, invert. Conditions: chasing,
+// timer_done <slot>, chance <p>, player_within <px>. Actions: chase, flee,
+// wander, stop, set_timer <slot> [seconds], succeed. Without seconds,
+// set_timer uses the agent's directionChangeInterval.
+//
+// Tree 0 is a built-in default (chase when chasing, otherwise wander), used
+// by agents whose archetype has no tree.
+class BehaviorTreeLibrary {
+public:
+    static BehaviorTreeLibrary& instance() {
+        static BehaviorTreeLibrary inst;
+        return inst;
+    }
+
+    bool loadFromFile(const std::string& path) {
+        std::ifstream file(path);
+        if (!file) {
+            std::cerr << "[BehaviorTreeLibrary] Failed to open behavior trees: " << path << "\n";
+            return false;
+        }
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        return parse(buffer.str());
+    }
+
+    // Replaces every loaded tree; broken ones are skipped and reported
+    bool parse(const std::string& text) {
+        trees.resize(1);  // Keep the built-in default
+        return compile(text, trees);
+    }
+
+    // Id of the named tree, or 0 (the default) if there is none
+    std::uint16_t find(const std::string& name) const {
+        for (size_t i = 0; i < trees.size(); ++i) {
+            if (trees[i].name == name) return static_cast<std::uint16_t>(i);
+        }
+        return 0;
+    }
+
+    const BehaviorTree& get(std::uint16_t id) const { return id < trees.size() ? trees[id] : trees[0]; }
+
+    size_t size() const { return trees.size(); }
+
+private:
+    BehaviorTreeLibrary() {
+        compile(DEFAULT_TREE, trees);
+    }
+
+    struct ParsedNode {
+        BTNode node;
+        int indent;
+        std::vector<std::unique_ptr<ParsedNode>> children;
+    };
+
+    static bool compile(const std::string& text, std::vector<BehaviorTree>& out) {
+        std::istringstream stream(text);
+        std::string line;
+        int lineNumber = 0;
+        bool ok = true;
+
+        BehaviorTree current;
+        std::unique_ptr<ParsedNode> root;
+        std::vector<ParsedNode*> stack;  // Open nodes, outermost first
+        bool inTree = false, broken = false;
+
+        auto finish = [&]() {
+            if (!inTree) return;
+            std::string error;
+            if (!broken && !root) {
+                error = "is empty";
+            } else if (!broken && flatten(*root, current, error)) {
+                out.push_back(current);
+            }
+            if (!error.empty()) {
+                std::cerr << "[BehaviorTreeLibrary] Tree " << current.name << " " << error << "\n";
+                ok = false;
+            }
+            inTree = false;
+        };
+
+        while (std::getline(stream, line)) {
+            ++lineNumber;
+            if (!line.empty() && line.back() == '\r') line.pop_back();
+            std::istringstream fields(line);
+            std::string word;
+            if (!(fields >> word) || word[0] == '#') continue;
+
+            if (word.front() == '[' && word.back() == ']' && word.size() > 2) {
+                finish();
+                current = BehaviorTree{};
+                current.name = word.substr(1, word.size() - 2);
+                root.reset();
+                stack.clear();
+                inTree = true;
+                broken = false;
+                continue;
+            }
+            if (!inTree || broken) continue;
+
+            int indent = static_cast<int>(line.find_first_not_of(" \t"));
+            auto node = std::make_unique<ParsedNode>();
+            node->indent = indent;
+            bool valid = parseNode(word, fields, current, node->node);
+
+            while (valid && !stack.empty() && stack.back()->indent >= indent) stack.pop_back();
+            if (valid && stack.empty() && root) valid = false;  // A second root
+            if (valid && !stack.empty() && !isComposite(stack.back()->node.op)) valid = false;
+
+            if (!valid) {
+                std::cerr << "[BehaviorTreeLibrary] Malformed line " << lineNumber << ": " << line << "\n";
+                ok = false;
+                broken = true;  // Drop the rest of this tree
+                continue;
+            }
+
+            ParsedNode* raw = node.get();
+            if (stack.empty()) {
+                root = std::move(node);
+            } else {
+                stack.back()->children.push_back(std::move(node));
+            }
+            stack.push_back(raw);
+        }
+        finish();
+        return ok;
+    }
+
+    static bool isComposite(BTOp op) {
+        return op == BTOp::Selector || op == BTOp::Sequence || op == BTOp::Invert;
+    }
+
+    static bool parseNode(const std::string& word, std::istringstream& fields, BehaviorTree& tree, BTNode& node) {
+        static const std::pair<const char*, BTOp> OPS[] = {
+            {"selector", BTOp::Selector}, {"sequence", BTOp::Sequence}, {"invert", BTOp::Invert},
+            {"chasing", BTOp::Chasing}, {"timer_done", BTOp::TimerDone}, {"chance", BTOp::Chance},
+            {"player_within", BTOp::PlayerWithin}, {"chase", BTOp::Chase}, {"flee", BTOp::Flee},
+            {"wander", BTOp::Wander}, {"stop", BTOp::Stop}, {"set_timer", BTOp::SetTimer},
+            {"succeed", BTOp::Succeed},
+        };
+        bool known = false;
+        for (const auto& [name, op] : OPS) {
+            if (word == name) { node.op = op; known = true; break; }
+        }
+        if (!known) return false;
+
+        if (node.op == BTOp::TimerDone || node.op == BTOp::SetTimer) {
+            std::string slot;
+            if (!(fields >> slot) || !slotIndex(tree, slot, node.slot)) return false;
+        }
+        if (node.op == BTOp::Chance || node.op == BTOp::PlayerWithin || node.op == BTOp::SetTimer) {
+            if (!(fields >> node.param)) {
+                if (node.op != BTOp::SetTimer) return false;  // Its seconds are optional
+                node.param = -1.f;
+            } else if (node.param < 0.f || (node.op == BTOp::Chance && node.param > 1.f)) {
+                return false;
+            }
+        }
+        std::string extra;
+        return !(fields >> extra);
+    }
+
+    static bool slotIndex(BehaviorTree& tree, const std::string& name, std::uint8_t& out) {
+        for (size_t i = 0; i < tree.slots.size(); ++i) {
+            if (tree.slots[i] == name) { out = static_cast<std::uint8_t>(i); return true; }
+        }
+        if (tree.slots.size() >= AIComponent::BLACKBOARD_SLOTS) return false;
+        tree.slots.push_back(name);
+        out = static_cast<std::uint8_t>(tree.slots.size() - 1);
+        return true;
+    }
+
+    static bool flatten(const ParsedNode& parsed, BehaviorTree& tree, std::string& error) {
+        if (isComposite(parsed.node.op) && parsed.children.empty()) {
+            error = "has a composite without children";
+            return false;
+        }
+        if (parsed.node.op == BTOp::Invert && parsed.children.size() != 1) {
+            error = "has an invert without exactly one child";
+            return false;
+        }
+        if (tree.nodes.size() >= 0xFFFF) {
+            error = "is too large";
+            return false;
+        }
+
+        size_t index = tree.nodes.size();
+        tree.nodes.push_back(parsed.node);
+        for (const auto& child : parsed.children) {
+            if (!flatten(*child, tree, error)) return false;
+        }
+        tree.nodes[index].end = static_cast<std::uint16_t>(tree.nodes.size());
+        return true;
+    }
+
+    static constexpr const char* DEFAULT_TREE =
+        "[default]\n"
+        "selector\n"
+        "  sequence\n"
+        "    chasing\n"
+        "    chase\n"
+        "  sequence\n"
+        "    timer_done wander\n"
+        "    wander\n"
+        "    set_timer wander\n"
+        "  succeed\n";
+
+    std::vector<BehaviorTree> trees;
+
+    BehaviorTreeLibrary(const BehaviorTreeLibrary&) = delete;
+    BehaviorTreeLibrary& operator=(const BehaviorTreeLibrary&) = delete;
+};
@@ -1,7 +1,12 @@
 #pragma once
 
 #include <SFML/Graphics.hpp>
-#include <string>
+#include "../core/StringId.hpp"
+#include "../core/TimerWheel.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
 
 // Base component class
 class Component {
@@ -11,7 +16,7 @@ public:
 
 // Rendering
 struct SpriteComponent : Component {
-    std::string textureId;
+    StringId textureId;  // Interned at spawn; empty means untextured
     sf::Vector2f size{32.f, 32.f};
     sf::Color color{sf::Color::White};
     sf::Vector2f origin{0.f, 0.f};  // Offset from center
@@ -30,6 +35,9 @@ struct PhysicsComponent : Component {
     float speed = 100.f;
     bool clampToRoom = true;
     sf::FloatRect roomBounds;
+    sf::Vector2f collisionHalfSize{16.f, 16.f};  // Box used against walls and obstacles
+    bool flying = false;                          // Passes over pits
+    sf::Vector2f lastMove{0.f, 0.f};              // Displacement of the last physics step
 
     PhysicsComponent() = default;
     explicit PhysicsComponent(float speed) : speed(speed) {}
@@ -39,26 +47,23 @@ struct PhysicsComponent : Component {
 struct HealthComponent : Component {
     int current = 3;
     int max = 3;
-    float invincibilityTimer = 0.f;
     float invincibilityDuration = 0.5f;
+    Timer invincibility;  // Pending while invincible
 
     HealthComponent() = default;
     HealthComponent(int hp, float invincDuration = 0.5f)
         : current(hp), max(hp), invincibilityDuration(invincDuration) {}
 
-    bool isInvincible() const { return invincibilityTimer > 0.f; }
+    bool isInvincible() const { return invincibility.isPending(); }
     bool isAlive() const { return current > 0; }
 
-    void takeDamage(int amount) {
+    // Invincibility runs on clock, which must outlive this component
+    void takeDamage(int amount, TimerWheel& clock) {
         if (!isInvincible()) {
             current -= amount;
-            invincibilityTimer = invincibilityDuration;
-        }
-    }
-
-    void update(float dt) {
-        if (invincibilityTimer > 0.f) {
-            invincibilityTimer -= dt;
+            if (invincibilityDuration > 0.f) {
+                invincibility.start(clock, invincibilityDuration);
+            }
         }
     }
 };
@@ -103,31 +108,68 @@ struct HitboxComponent : Component {
     }
 };
 
-// AI Behavior
+// Fires projectiles at the player while its AI is chasing (ProjectileSystem)
+struct RangedAttackComponent : Component {
+    float reloadTime = 1.5f;
+    float projectileSpeed = 180.f;
+    float projectileLifetime = 3.f;
+    int damage = 1;
+    int shots = 1;        // Per volley, fanned out around the aim
+    float spread = 0.f;   // Radians between neighboring shots
+    Timer reload;         // Pending until the next volley
+
+    RangedAttackComponent() = default;
+};
+
+// AI archetype label; what an agent actually does comes from its behavior tree
 enum class AIBehavior { Wander, Chase, Erratic };
 
+// How often an AI makes decisions: every tick, every 2nd or every 4th
+enum class AILod : std::uint8_t { Full, Half, Quarter };
+
 struct AIComponent : Component {
     AIBehavior behavior = AIBehavior::Wander;
     float detectionRadius = 150.f;
     float loseRadius = 200.f;
     float wanderSpeed = 40.f;
     float chaseSpeed = 80.f;
-    float wanderTimer = 0.f;
     float directionChangeInterval = 1.f;
     bool isChasing = false;
 
+    // Behavior tree (BehaviorTreeLibrary id, 0 is the built-in default) and
+    // its per-entity slots, used as timers that count down between decisions
+    static constexpr size_t BLACKBOARD_SLOTS = 4;
+    std::uint16_t tree = 0;
+    std::array<float, BLACKBOARD_SLOTS> blackboard{};
+
+    // Scheduling, owned by AISystem
+    AILod lod = AILod::Full;
+    bool overdue = false;       // Skipped by the time budget; decides next tick
+    float sinceDecision = 0.f;  // Time accumulated since the last decision
+
     AIComponent() = default;
     AIComponent(AIBehavior behavior, float detectRadius, float wanderSpd, float chaseSpd)
         : behavior(behavior), detectionRadius(detectRadius),
           wanderSpeed(wanderSpd), chaseSpeed(chaseSpd) {}
 };
 
+// Crowd steering (boids). Separation keeps agents from stacking; alignment
+// and cohesion, when weighted, make neighbors move as a flock.
+struct SteeringComponent : Component {
+    float neighborRadius = 48.f;     // Range for alignment and cohesion
+    float separationRadius = 28.f;   // Agents closer than this push apart
+    float separationWeight = 300.f;  // px/s^2 at full overlap
+    float alignmentWeight = 0.f;     // 1/s toward the neighbors' mean velocity
+    float cohesionWeight = 0.f;      // 1/s^2 toward the neighbors' center
+    float maxSpeed = 100.f;
+};
+
 // Player control marker
 struct PlayerControlComponent : Component {
     float attackDuration = 0.15f;
     float attackCooldown = 0.3f;
-    float attackTimer = 0.f;
-    float cooldownTimer = 0.f;
+    Timer attack;    // Ends the swing when it fires
+    Timer cooldown;  // Pending while the next swing is locked out
     bool isAttacking = false;
     sf::Vector2f facing{1.f, 0.f};
 
@@ -146,8 +188,133 @@ struct PickupComponent : Component {
     PickupComponent(PickupType type, int value) : type(type), value(value) {}
 };
 
+// Stats that status effects can modify
+enum class Stat : std::uint8_t { MoveSpeed, Damage };
+constexpr size_t STAT_COUNT = 2;
+
+// A timed stat modifier. Effects of the same kind stack, each stack with
+// its own expiry; applying one more than maxStacks refreshes the stack that
+// would expire first instead.
+struct StatusEffect {
+    std::uint8_t kind = 0;  // Caller-defined, e.g. the PickupType that granted it
+    Stat stat = Stat::MoveSpeed;
+    float add = 0.f;        // Summed over stacks, then...
+    float multiply = 1.f;   // ...multiplied by every stack's factor
+    float duration = 1.f;
+    int maxStacks = 1;
+};
+
+// Active effects and the unmodified stats they apply to. StatusEffectSystem
+// writes the derived stats into the entity's other components only when
+// the set of effects changes, so unaffected ticks cost nothing.
+struct StatusEffectComponent : Component {
+    struct Active {
+        StatusEffect effect;
+        std::uint64_t expiresAt;  // Game clock tick
+    };
+
+    std::array<float, STAT_COUNT> base{};
+    bool dirty = false;  // Set whenever an effect starts or ends
+
+    StatusEffectComponent() = default;
+
+    void setBase(Stat stat, float value) {
+        base[static_cast<size_t>(stat)] = value;
+        dirty = true;
+    }
+
+    // Expiry runs on clock, which must outlive this component
+    void apply(const StatusEffect& effect, TimerWheel& clock) {
+        std::uint64_t expiresAt = clock.getTick() + TimerWheel::toTicks(effect.duration);
+
+        if (stacks(effect.kind) >= static_cast<size_t>(std::max(effect.maxStacks, 1))) {
+            auto oldest = active.end();
+            for (auto it = active.begin(); it != active.end(); ++it) {
+                if (it->effect.kind == effect.kind && (oldest == active.end() || it->expiresAt < oldest->expiresAt)) {
+                    oldest = it;
+                }
+            }
+            active.erase(oldest);
+            std::make_heap(active.begin(), active.end(), expiresLater);
+        }
+
+        active.push_back({effect, expiresAt});
+        std::push_heap(active.begin(), active.end(), expiresLater);
+        dirty = true;
+        scheduleNextExpiry(clock);
+    }
+
+    size_t stacks(std::uint8_t kind) const {
+        return static_cast<size_t>(std::count_if(active.begin(), active.end(),
+            [kind](const Active& a) { return a.effect.kind == kind; }));
+    }
+
+    const std::vector<Active>& getActive() const { return active; }
+
+    // The active effects with their durations cut to the time they have
+    // left, for re-applying to a new entity (the player is rebuilt in every
+    // room). Soonest to expire first.
+    std::vector<StatusEffect> carryOver(const TimerWheel& clock) const {
+        std::vector<Active> sorted = active;
+        std::sort(sorted.begin(), sorted.end(),
+                  [](const Active& a, const Active& b) { return a.expiresAt < b.expiresAt; });
+
+        std::vector<StatusEffect> result;
+        for (const auto& a : sorted) {
+            if (a.expiresAt <= clock.getTick()) continue;
+            StatusEffect effect = a.effect;
+            effect.duration = static_cast<float>(a.expiresAt - clock.getTick()) * TimerWheel::TICK;
+            result.push_back(effect);
+        }
+        return result;
+    }
+
+    // (base + every add) * every multiply
+    float derived(Stat stat) const {
+        float add = 0.f, multiply = 1.f;
+        for (const auto& a : active) {
+            if (a.effect.stat != stat) continue;
+            add += a.effect.add;
+            multiply *= a.effect.multiply;
+        }
+        return (base[static_cast<size_t>(stat)] + add) * multiply;
+    }
+
+private:
+    // Min-heap on expiresAt, so the next effect to end is always active.front()
+    static bool expiresLater(const Active& a, const Active& b) { return a.expiresAt > b.expiresAt; }
+
+    // One wheel timer per entity, always for the earliest expiry
+    void scheduleNextExpiry(TimerWheel& clock) {
+        if (active.empty()) {
+            expiry.stop();
+            return;
+        }
+        std::uint64_t now = clock.getTick();
+        std::uint64_t ticks = active.front().expiresAt > now ? active.front().expiresAt - now : 0;
+        expiry.start(clock, static_cast<float>(ticks) * TimerWheel::TICK, [this, &clock]() { expire(clock); });
+    }
+
+    void expire(TimerWheel& clock) {
+        while (!active.empty() && active.front().expiresAt <= clock.getTick()) {
+            std::pop_heap(active.begin(), active.end(), expiresLater);
+            active.pop_back();
+            dirty = true;
+        }
+        scheduleNextExpiry(clock);
+    }
+
+    std::vector<Active> active;
+    Timer expiry;
+};
+
 // Tag for enemies (used by room to track clear state)
-struct EnemyTag : Component {};
+struct EnemyTag : Component {
+    int type = 0;  // EntityFactory::EnemyType, so the enemy can be re-created
+
+    EnemyTag() = default;
+    explicit EnemyTag(int type) : type(type) {}
+};
 
 // Tag for pickups
 struct PickupTag : Component {};
@@ -2,6 +2,7 @@
 
 #include "EntityManager.hpp"
 #include "Component.hpp"
+#include "BehaviorTree.hpp"
 
 namespace EntityFactory {
 
@@ -10,7 +11,9 @@ inline Entity& createPlayer(EntityManager& manager, sf::Vector2f position, const
     player.position = position;
 
     // Sprite
+    static const StringId playerTexture = intern("player");
     auto& sprite = player.addComponent<SpriteComponent>();
+    sprite.textureId = playerTexture;
     sprite.size = {32.f, 32.f};
     sprite.origin = {16.f, 16.f};
     sprite.color = sf::Color::Green;
@@ -37,10 +40,15 @@ inline Entity& createPlayer(EntityManager& manager, sf::Vector2f position, const
     // Player control
     player.addComponent<PlayerControlComponent>();
 
+    // Status effects from pickups modify these stats
+    auto& effects = player.addComponent<StatusEffectComponent>();
+    effects.setBase(Stat::MoveSpeed, physics.speed);
+    effects.setBase(Stat::Damage, static_cast<float>(hitbox.damage));
+
     return player;
 }
 
-enum class EnemyType { Slime, Bat };
+enum class EnemyType { Slime, Bat, Archer };
 
 inline Entity& createEnemy(EntityManager& manager, EnemyType type, sf::Vector2f position, const sf::FloatRect& roomBounds) {
     Entity& enemy = manager.createEntity();
@@ -54,6 +62,7 @@ inline Entity& createEnemy(EntityManager& manager, EnemyType type, sf::Vector2f
     auto& physics = enemy.addComponent<PhysicsComponent>();
     physics.roomBounds = roomBounds;
     physics.clampToRoom = true;
+    physics.collisionHalfSize = {14.f, 14.f};
 
     // Health
     enemy.addComponent<HealthComponent>(1, 0.f);
@@ -65,11 +74,19 @@ inline Entity& createEnemy(EntityManager& manager, EnemyType type, sf::Vector2f
     auto& ai = enemy.addComponent<AIComponent>();
 
     // Enemy tag
-    enemy.addComponent<EnemyTag>();
+    enemy.addComponent<EnemyTag>(static_cast<int>(type));
+
+    // Crowd steering
+    auto& steering = enemy.addComponent<SteeringComponent>();
+
+    static const StringId slimeTexture = intern("slime");
+    static const StringId batTexture = intern("bat");
+    static const StringId archerTexture = intern("archer");
 
     // Configure based on type
     switch (type) {
         case EnemyType::Slime:
+            sprite.textureId = slimeTexture;
             sprite.size = {28.f, 28.f};
             sprite.color = sf::Color(180, 50, 50);
             ai.behavior = AIBehavior::Wander;
@@ -78,9 +95,12 @@ inline Entity& createEnemy(EntityManager& manager, EnemyType type, sf::Vector2f
             ai.detectionRadius = 150.f;
             ai.loseRadius = 200.f;
             ai.directionChangeInterval = 1.f;
+            ai.tree = BehaviorTreeLibrary::instance().find("slime");
+            steering.maxSpeed = ai.chaseSpeed;
             break;
 
         case EnemyType::Bat:
+            sprite.textureId = batTexture;
             sprite.size = {24.f, 24.f};
             sprite.origin = {12.f, 12.f};
             sprite.color = sf::Color(100, 50, 150);
@@ -90,27 +110,72 @@ inline Entity& createEnemy(EntityManager& manager, EnemyType type, sf::Vector2f
             ai.detectionRadius = 120.f;
             ai.loseRadius = 180.f;
             ai.directionChangeInterval = 0.3f;
+            ai.tree = BehaviorTreeLibrary::instance().find("bat");
+            physics.flying = true;
+            steering.neighborRadius = 72.f;
+            steering.separationRadius = 24.f;
+            steering.alignmentWeight = 2.f;
+            steering.cohesionWeight = 1.5f;
+            steering.maxSpeed = ai.chaseSpeed;
             break;
+
+        case EnemyType::Archer: {
+            sprite.textureId = archerTexture;
+            sprite.size = {26.f, 26.f};
+            sprite.origin = {13.f, 13.f};
+            sprite.color = sf::Color(200, 170, 80);
+            ai.behavior = AIBehavior::Chase;
+            ai.wanderSpeed = 30.f;
+            ai.chaseSpeed = 60.f;
+            ai.detectionRadius = 220.f;
+            ai.loseRadius = 300.f;
+            ai.directionChangeInterval = 1.5f;
+            ai.tree = BehaviorTreeLibrary::instance().find("archer");
+            steering.maxSpeed = ai.chaseSpeed;
+
+            auto& ranged = enemy.addComponent<RangedAttackComponent>();
+            ranged.reloadTime = 1.6f;
+            ranged.projectileSpeed = 160.f;
+            ranged.shots = 3;
+            ranged.spread = 0.2f;
+            break;
+        }
     }
 
     return enemy;
 }
 
-inline Entity& createHealthPickup(EntityManager& manager, sf::Vector2f position) {
+inline Entity& createPickup(EntityManager& manager, PickupType type, int value, sf::Vector2f position) {
     Entity& pickup = manager.createEntity();
     pickup.position = position;
 
     // Sprite
+    static const StringId healthPickupTexture = intern("pickup_health");
+    static const StringId speedPickupTexture = intern("pickup_speed");
+    static const StringId damagePickupTexture = intern("pickup_damage");
     auto& sprite = pickup.addComponent<SpriteComponent>();
     sprite.size = {16.f, 16.f};
     sprite.origin = {8.f, 8.f};
-    sprite.color = sf::Color::Red;
+    switch (type) {
+        case PickupType::Health:
+            sprite.textureId = healthPickupTexture;
+            sprite.color = sf::Color::Red;
+            break;
+        case PickupType::SpeedBoost:
+            sprite.textureId = speedPickupTexture;
+            sprite.color = sf::Color(0, 200, 255);
+            break;
+        case PickupType::DamageUp:
+            sprite.textureId = damagePickupTexture;
+            sprite.color = sf::Color(255, 140, 0);
+            break;
+    }
 
     // Hurtbox for collision detection
     pickup.addComponent<HurtboxComponent>(sf::Vector2f{16.f, 16.f});
 
     // Pickup component
-    pickup.addComponent<PickupComponent>(PickupType::Health, 1);
+    pickup.addComponent<PickupComponent>(type, value);
 
     // Tag
     pickup.addComponent<PickupTag>();
@@ -118,4 +183,8 @@ inline Entity& createHealthPickup(EntityManager& manager, sf::Vector2f position)
     return pickup;
 }
 
+inline Entity& createHealthPickup(EntityManager& manager, sf::Vector2f position) {
+    return createPickup(manager, PickupType::Health, 1, position);
+}
+
 } // namespace EntityFactory
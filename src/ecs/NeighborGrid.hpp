@@ -0,0 +1,91 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+// Uniform grid over a set of points for radius queries. Rebuilt from scratch
+// each tick with a counting sort, so building and querying a crowd of n
+// agents is O(n) overall instead of the O(n^2) of testing every pair.
+//
+// Points are stored by cell (cellStart/order), which keeps each cell's
+// members contiguous for the 3x3 block a query visits.
+class NeighborGrid {
+public:
+    // cellSize must be at least the largest query radius
+    void build(const std::vector<sf::Vector2f>& points, float cellSize) {
+        count = points.size();
+        if (count == 0) return;
+
+        sf::Vector2f min = points[0], max = points[0];
+        for (const auto& p : points) {
+            min.x = std::min(min.x, p.x); min.y = std::min(min.y, p.y);
+            max.x = std::max(max.x, p.x); max.y = std::max(max.y, p.y);
+        }
+
+        // Widely scattered points would need a huge, mostly empty grid;
+        // grow the cells instead so memory stays proportional to n
+        size_t maxCells = MAX_CELLS_PER_POINT * count + 16;
+        cell = cellSize;
+        while (static_cast<size_t>(dimension(max.x - min.x)) * dimension(max.y - min.y) > maxCells) {
+            cell *= 2.f;
+        }
+        origin = min;
+        cols = dimension(max.x - min.x);
+        rows = dimension(max.y - min.y);
+
+        cellStart.assign(static_cast<size_t>(cols) * rows + 1, 0);
+        cellOf.resize(count);
+        for (size_t i = 0; i < count; ++i) {
+            cellOf[i] = cellIndex(column(points[i].x), row(points[i].y));
+            ++cellStart[cellOf[i] + 1];
+        }
+        for (size_t c = 1; c < cellStart.size(); ++c) {
+            cellStart[c] += cellStart[c - 1];
+        }
+
+        order.resize(count);
+        cursor.assign(cellStart.begin(), cellStart.end() - 1);
+        for (size_t i = 0; i < count; ++i) {
+            order[cursor[cellOf[i]]++] = static_cast<std::uint32_t>(i);
+        }
+    }
+
+    // Calls visit(index) for every point in the cells around p; callers
+    // filter by exact distance. Includes p's own index if it is a point.
+    template<typename Visit>
+    void forEachNear(sf::Vector2f p, Visit&& visit) const {
+        if (count == 0) return;
+        int col = column(p.x), r = row(p.y);
+        for (int y = std::max(r - 1, 0); y <= std::min(r + 1, rows - 1); ++y) {
+            for (int x = std::max(col - 1, 0); x <= std::min(col + 1, cols - 1); ++x) {
+                size_t c = cellIndex(x, y);
+                for (std::uint32_t k = cellStart[c]; k < cellStart[c + 1]; ++k) {
+                    visit(order[k]);
+                }
+            }
+        }
+    }
+
+    size_t size() const { return count; }
+
+private:
+    int dimension(float extent) const { return static_cast<int>(extent / cell) + 1; }
+
+    int column(float x) const { return std::clamp(static_cast<int>(std::floor((x - origin.x) / cell)), 0, cols - 1); }
+    int row(float y) const { return std::clamp(static_cast<int>(std::floor((y - origin.y) / cell)), 0, rows - 1); }
+    size_t cellIndex(int x, int y) const { return static_cast<size_t>(y) * cols + x; }
+
+    static constexpr size_t MAX_CELLS_PER_POINT = 4;
+
+    size_t count = 0;
+    float cell = 1.f;
+    sf::Vector2f origin{0.f, 0.f};
+    int cols = 0, rows = 0;
+    std::vector<std::uint32_t> cellStart;  // Prefix sums: cell c holds order[cellStart[c], cellStart[c+1])
+    std::vector<std::uint32_t> order;
+    std::vector<size_t> cellOf;
+    std::vector<std::uint32_t> cursor;
+};
@@ -0,0 +1,197 @@
+#pragma once
+
+#include "Component.hpp"
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// Live projectiles in structure-of-arrays form. Projectiles are not
+// entities: there can be tens of thousands of them, each only a position,
+// a velocity and a few bytes of payload, so they live in flat arrays sized
+// once up front and are removed by swapping with the last one.
+class ProjectilePool {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 32768;
+
+    explicit ProjectilePool(size_t capacity = DEFAULT_CAPACITY)
+        : posX(capacity), posY(capacity), velX(capacity), velY(capacity), life(capacity),
+          owner(capacity), damage(capacity), faction(capacity) {}
+
+    std::vector<float> posX, posY;
+    std::vector<float> velX, velY;
+    std::vector<float> life;            // Seconds left before it fizzles
+    std::vector<unsigned int> owner;    // Entity id of the shooter
+    std::vector<std::uint8_t> damage;
+    std::vector<Faction> faction;
+
+    // False when the pool is full; the shot is simply dropped
+    bool spawn(sf::Vector2f position, sf::Vector2f velocity, float lifetime, int dmg, Faction side,
+               unsigned int shooter = 0) {
+        if (count == capacity()) return false;
+        size_t i = count++;
+        posX[i] = position.x;
+        posY[i] = position.y;
+        velX[i] = velocity.x;
+        velY[i] = velocity.y;
+        life[i] = lifetime;
+        owner[i] = shooter;
+        damage[i] = static_cast<std::uint8_t>(std::clamp(dmg, 0, 255));
+        faction[i] = side;
+        maxSpeed = std::max(maxSpeed, std::sqrt(velocity.x * velocity.x + velocity.y * velocity.y));
+        return true;
+    }
+
+    // Moves the last projectile into slot i
+    void remove(size_t i) {
+        size_t last = --count;
+        posX[i] = posX[last];
+        posY[i] = posY[last];
+        velX[i] = velX[last];
+        velY[i] = velY[last];
+        life[i] = life[last];
+        owner[i] = owner[last];
+        damage[i] = damage[last];
+        faction[i] = faction[last];
+    }
+
+    void clear() {
+        count = 0;
+        maxSpeed = 0.f;
+    }
+
+    size_t size() const { return count; }
+    size_t capacity() const { return posX.size(); }
+    bool empty() const { return count == 0; }
+
+    // Fastest projectile spawned since the last clear, for step subdivision
+    float getMaxSpeed() const { return maxSpeed; }
+
+private:
+    size_t count = 0;
+    float maxSpeed = 0.f;
+};
+
+// Advances projectiles [begin, end) by dt: position += velocity * dt and
+// life -= dt. Expiry is left to the caller.
+inline void integrateProjectilesScalar(ProjectilePool& pool, float dt, size_t begin, size_t end) {
+    float* px = pool.posX.data();
+    float* py = pool.posY.data();
+    const float* vx = pool.velX.data();
+    const float* vy = pool.velY.data();
+    float* life = pool.life.data();
+    for (size_t i = begin; i < end; ++i) {
+        px[i] += vx[i] * dt;
+        py[i] += vy[i] * dt;
+        life[i] -= dt;
+    }
+}
+
+inline void integrateProjectilesScalar(ProjectilePool& pool, float dt) {
+    integrateProjectilesScalar(pool, dt, 0, pool.size());
+}
+
+#if defined(__AVX2__)
+// No FMA, so results match the scalar kernel bit for bit
+inline void integrateProjectilesAvx2(ProjectilePool& pool, float dt) {
+    const size_t count = pool.size();
+    const size_t vectorEnd = count - count % 8;
+    const __m256 step = _mm256_set1_ps(dt);
+
+    for (size_t i = 0; i < vectorEnd; i += 8) {
+        __m256 x = _mm256_add_ps(_mm256_loadu_ps(&pool.posX[i]), _mm256_mul_ps(_mm256_loadu_ps(&pool.velX[i]), step));
+        __m256 y = _mm256_add_ps(_mm256_loadu_ps(&pool.posY[i]), _mm256_mul_ps(_mm256_loadu_ps(&pool.velY[i]), step));
+        _mm256_storeu_ps(&pool.posX[i], x);
+        _mm256_storeu_ps(&pool.posY[i], y);
+        _mm256_storeu_ps(&pool.life[i], _mm256_sub_ps(_mm256_loadu_ps(&pool.life[i]), step));
+    }
+
+    integrateProjectilesScalar(pool, dt, vectorEnd, count);
+}
+#endif
+
+// Uses the AVX2 kernel when the build enables it (ENABLE_AVX2 in CMake)
+inline void integrateProjectiles(ProjectilePool& pool, float dt) {
+#if defined(__AVX2__)
+    integrateProjectilesAvx2(pool, dt);
+#else
+    integrateProjectilesScalar(pool, dt);
+#endif
+}
+
+// Uniform grid of target boxes over a fixed area, for point queries. Each
+// box is listed in every cell it overlaps, so a projectile looks at one cell
+// (almost always empty) instead of every target in the room. Rebuilt each
+// tick with a counting sort; targets are few, projectiles are many.
+class TargetGrid {
+public:
+    void build(const std::vector<sf::FloatRect>& boxes, const sf::FloatRect& area, float cellSize) {
+        origin = area.position;
+        cell = cellSize;
+        cols = std::max(1, static_cast<int>(std::ceil(area.size.x / cell)));
+        rows = std::max(1, static_cast<int>(std::ceil(area.size.y / cell)));
+
+        // Cell ranges per box, clamped to the area; empty if entirely outside
+        spans.resize(boxes.size());
+        cellStart.assign(static_cast<size_t>(cols) * rows + 1, 0);
+        for (size_t b = 0; b < boxes.size(); ++b) {
+            const auto& box = boxes[b];
+            Span& span = spans[b];
+            span.col0 = std::max(column(box.position.x), 0);
+            span.row0 = std::max(row(box.position.y), 0);
+            span.col1 = std::min(column(box.position.x + box.size.x), cols - 1);
+            span.row1 = std::min(row(box.position.y + box.size.y), rows - 1);
+            forEachCell(span, [this](size_t c) { ++cellStart[c + 1]; });
+        }
+        for (size_t c = 1; c < cellStart.size(); ++c) {
+            cellStart[c] += cellStart[c - 1];
+        }
+
+        items.resize(cellStart.back());
+        cursor.assign(cellStart.begin(), cellStart.end() - 1);
+        for (size_t b = 0; b < boxes.size(); ++b) {
+            forEachCell(spans[b], [this, b](size_t c) { items[cursor[c]++] = static_cast<std::uint32_t>(b); });
+        }
+    }
+
+    // Calls visit(boxIndex) for every box listed in the cell containing p;
+    // callers test the box itself
+    template<typename Visit>
+    void forEachAt(float x, float y, Visit&& visit) const {
+        int c = column(x), r = row(y);
+        if (c < 0 || c >= cols || r < 0 || r >= rows) return;
+        size_t index = static_cast<size_t>(r) * cols + c;
+        for (std::uint32_t k = cellStart[index]; k < cellStart[index + 1]; ++k) {
+            visit(items[k]);
+        }
+    }
+
+private:
+    struct Span { int col0, row0, col1, row1; };
+
+    template<typename Fn>
+    void forEachCell(const Span& span, Fn&& fn) const {
+        for (int r = span.row0; r <= span.row1; ++r) {
+            for (int c = span.col0; c <= span.col1; ++c) {
+                fn(static_cast<size_t>(r) * cols + c);
+            }
+        }
+    }
+
+    int column(float x) const { return static_cast<int>(std::floor((x - origin.x) / cell)); }
+    int row(float y) const { return static_cast<int>(std::floor((y - origin.y) / cell)); }
+
+    sf::Vector2f origin{0.f, 0.f};
+    float cell = 1.f;
+    int cols = 0, rows = 0;
+    std::vector<Span> spans;
+    std::vector<std::uint32_t> cellStart;  // Prefix sums: cell c holds items[cellStart[c], cellStart[c+1])
+    std::vector<std::uint32_t> items;
+    std::vector<std::uint32_t> cursor;
+};
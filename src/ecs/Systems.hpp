@@ -2,19 +2,44 @@
 
 #include "EntityManager.hpp"
 #include "Component.hpp"
+#include "AIKernel.hpp"
+#include "BehaviorTree.hpp"
+#include "NeighborGrid.hpp"
+#include "Projectiles.hpp"
 #include "../core/EventBus.hpp"
+#include "../core/AssetManager.hpp"
+#include "../game/CollisionGrid.hpp"
+#include "../game/LineOfSight.hpp"
 #include "../util/Random.hpp"
+#include "../util/Sweep.hpp"
 #include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <limits>
+#include <vector>
 
 // Physics System - handles movement and room clamping
 class PhysicsSystem {
 public:
+    // Obstacles of the current room; nullptr for none
+    void setCollisionGrid(const CollisionGrid* grid) { collisionGrid = grid; }
+
     void update(EntityManager& entities, float dt) {
-        entities.forEachWith<PhysicsComponent>([dt](Entity& entity) {
+        entities.forEachWith<PhysicsComponent>([this, dt](Entity& entity) {
             auto* physics = entity.getComponent<PhysicsComponent>();
-
-            entity.position += physics->velocity * dt;
+            sf::Vector2f start = entity.position;
+
+            sf::Vector2f delta = physics->velocity * dt;
+            if (collisionGrid) {
+                std::uint8_t mask = physics->flying ? CollisionGrid::BLOCKS_FLYERS : CollisionGrid::BLOCKS_WALKERS;
+                auto result = collisionGrid->move(entity.position, physics->collisionHalfSize, delta, mask);
+                entity.position = result.position;
+                if (result.hitX) physics->velocity.x = 0.f;
+                if (result.hitY) physics->velocity.y = 0.f;
+            } else {
+                entity.position += delta;
+            }
 
             // Apply friction
             if (physics->friction > 0.f) {
@@ -23,80 +48,301 @@ public:
 
             // Clamp to room bounds
             if (physics->clampToRoom) {
-                clampToRoom(entity.position, physics->roomBounds, 16.f);
+                clampToRoom(entity.position, physics->roomBounds, physics->collisionHalfSize);
             }
+            physics->lastMove = entity.position - start;
         });
     }
 
 private:
-    static void clampToRoom(sf::Vector2f& pos, const sf::FloatRect& bounds, float halfSize) {
-        if (pos.x - halfSize < bounds.position.x)
-            pos.x = bounds.position.x + halfSize;
-        if (pos.x + halfSize > bounds.position.x + bounds.size.x)
-            pos.x = bounds.position.x + bounds.size.x - halfSize;
-        if (pos.y - halfSize < bounds.position.y)
-            pos.y = bounds.position.y + halfSize;
-        if (pos.y + halfSize > bounds.position.y + bounds.size.y)
-            pos.y = bounds.position.y + bounds.size.y - halfSize;
+    static void clampToRoom(sf::Vector2f& pos, const sf::FloatRect& bounds, sf::Vector2f halfSize) {
+        if (pos.x - halfSize.x < bounds.position.x)
+            pos.x = bounds.position.x + halfSize.x;
+        if (pos.x + halfSize.x > bounds.position.x + bounds.size.x)
+            pos.x = bounds.position.x + bounds.size.x - halfSize.x;
+        if (pos.y - halfSize.y < bounds.position.y)
+            pos.y = bounds.position.y + halfSize.y;
+        if (pos.y + halfSize.y > bounds.position.y + bounds.size.y)
+            pos.y = bounds.position.y + bounds.size.y - halfSize.y;
     }
+
+    const CollisionGrid* collisionGrid = nullptr;
 };
 
 // AI System - handles enemy behavior
 class AISystem {
 public:
+    void seed(std::uint64_t value) {
+        rng = util::makeRng(value, util::RngStream::AI);
+    }
+
+    // Per-tick decision budget for Half and Quarter agents, converted to a
+    // decision count by the measured cost of recent decisions. Agents past it
+    // are deferred to the next tick, where the longest-waiting go first;
+    // Full-rate agents always decide and don't use it up. Any nonzero budget
+    // allows at least one reduced decision per tick, so deferred agents
+    // always catch up. Zero defers every reduced agent.
+    void setTimeBudget(std::chrono::microseconds value) { budget = value; }
+
+    // Agents only notice the player when this says they can see them;
+    // nullptr means everyone can see everything
+    void setLineOfSight(LineOfSight* value) { lineOfSight = value; }
+
+    struct Stats {
+        size_t agents = 0;
+        size_t decisions = 0;
+        size_t deferred = 0;
+    };
+    const Stats& getStats() const { return stats; }
+
+    // Agents only re-decide on their LOD's ticks, staggered by entity id so
+    // a horde doesn't all decide on the same tick. Between decisions they
+    // keep their velocity, which physics still integrates every tick.
+    //
+    // Due agents are gathered into an AIBatch and perceive the player in one
+    // kernel pass; then their behavior trees run, grouped so each tree is
+    // evaluated for all of its agents back to back.
     void update(EntityManager& entities, float dt, sf::Vector2f playerPos) {
-        entities.forEachWith<AIComponent, PhysicsComponent>([this, dt, playerPos](Entity& entity) {
+        ++tick;
+        stats = {};
+        batch.clear();
+        batchEntities.clear();
+        overdueAgents.clear();
+        dueAgents.clear();
+
+        entities.forEachWith<AIComponent, PhysicsComponent>([&](Entity& entity) {
             auto* ai = entity.getComponent<AIComponent>();
-            auto* physics = entity.getComponent<PhysicsComponent>();
-
-            float dx = playerPos.x - entity.position.x;
-            float dy = playerPos.y - entity.position.y;
-            float distToPlayer = std::sqrt(dx * dx + dy * dy);
+            ++stats.agents;
+            ai->sinceDecision += dt;
 
-            // State transitions
-            if (distToPlayer < ai->detectionRadius) {
-                ai->isChasing = true;
-            } else if (distToPlayer > ai->loseRadius) {
-                ai->isChasing = false;
-            }
+            unsigned int interval = 1u << static_cast<unsigned int>(ai->lod);
+            bool due = ai->overdue || (tick + entity.getId()) % interval == 0;
+            if (!due) return;
 
-            // Movement based on behavior
-            if (ai->isChasing) {
-                updateChase(physics, ai, entity.position, playerPos);
+            if (ai->lod == AILod::Full) {
+                admit(entity);
             } else {
-                updateWander(physics, ai, dt);
+                (ai->overdue ? overdueAgents : dueAgents).push_back(&entity);
             }
         });
+
+        // Reduced-rate agents share the allowance, those deferred longest
+        // first, so no agent can be pushed back tick after tick
+        std::stable_sort(overdueAgents.begin(), overdueAgents.end(), [](Entity* a, Entity* b) {
+            return a->getComponent<AIComponent>()->sinceDecision > b->getComponent<AIComponent>()->sinceDecision;
+        });
+        size_t allowance = decisionAllowance();
+        size_t reduced = 0;
+        for (auto* agents : {&overdueAgents, &dueAgents}) {
+            for (Entity* entity : *agents) {
+                if (reduced < allowance) {
+                    admit(*entity);
+                    ++reduced;
+                } else {
+                    entity->getComponent<AIComponent>()->overdue = true;
+                    ++stats.deferred;
+                }
+            }
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        runAIKernel(batch, playerPos);
+        if (lineOfSight) requireSight(playerPos);
+        groupByTree();
+
+        const auto& library = BehaviorTreeLibrary::instance();
+        for (size_t tree = 0; tree + 1 < treeStart.size(); ++tree) {
+            const BehaviorTree& behavior = library.get(static_cast<std::uint16_t>(tree));
+            for (std::uint32_t k = treeStart[tree]; k < treeStart[tree + 1]; ++k) {
+                applyDecision(*batchEntities[treeOrder[k]], treeOrder[k], behavior, playerPos);
+            }
+        }
+        stats.decisions = batchEntities.size();
+
+        if (!batchEntities.empty()) {
+            std::chrono::duration<float, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+            float sample = elapsed.count() / static_cast<float>(batchEntities.size());
+            nanosPerDecision = nanosPerDecision > 0.f ? nanosPerDecision * 0.9f + sample * 0.1f : sample;
+        }
     }
 
+    static constexpr float FULL_RATE_RADIUS = 320.f;  // Covers every loseRadius
+    static constexpr float HALF_RATE_RADIUS = 640.f;
+    static constexpr std::chrono::microseconds DEFAULT_BUDGET{500};
+
 private:
-    void updateWander(PhysicsComponent* physics, AIComponent* ai, float dt) {
-        ai->wanderTimer -= dt;
-        if (ai->wanderTimer <= 0.f) {
-            float interval = ai->behavior == AIBehavior::Erratic ? 0.3f : ai->directionChangeInterval;
-            float angle = util::randomFloat(0.f, 2.f * 3.14159f);
-            physics->velocity.x = std::cos(angle) * ai->wanderSpeed;
-            physics->velocity.y = std::sin(angle) * ai->wanderSpeed;
-            ai->wanderTimer = interval + util::randomFloat(0.f, interval);
+    void admit(Entity& entity) {
+        auto* ai = entity.getComponent<AIComponent>();
+        auto* physics = entity.getComponent<PhysicsComponent>();
+        batch.push(entity.position, ai->detectionRadius, ai->loseRadius, ai->chaseSpeed,
+                   ai->isChasing, physics->velocity);
+        batchEntities.push_back(&entity);
+    }
+
+    // How many reduced-rate decisions fit the budget, from the measured cost
+    // of recent ones
+    size_t decisionAllowance() const {
+        if (budget.count() == 0) return 0;
+        if (nanosPerDecision <= 0.f) return std::numeric_limits<size_t>::max();
+        std::chrono::duration<float, std::nano> total = budget;
+        return std::max<size_t>(static_cast<size_t>(total.count() / nanosPerDecision), 1);
+    }
+
+    // The kernel detects by radius alone; agents that would start chasing
+    // without a clear line to the player keep not noticing them. Agents
+    // already chasing keep following until out of their lose radius.
+    void requireSight(sf::Vector2f playerPos) {
+        lineOfSight->setTarget(playerPos);
+        for (size_t i = 0; i < batchEntities.size(); ++i) {
+            if (!batch.chasing[i] || batchEntities[i]->getComponent<AIComponent>()->isChasing) continue;
+            if (!lineOfSight->canSee(batchEntities[i]->position)) {
+                batch.chasing[i] = 0;
+            }
         }
     }
 
-    void updateChase(PhysicsComponent* physics, AIComponent* ai, sf::Vector2f entityPos, sf::Vector2f playerPos) {
-        sf::Vector2f dir = playerPos - entityPos;
-        float length = std::sqrt(dir.x * dir.x + dir.y * dir.y);
-        if (length > 0.f) {
-            dir.x /= length;
-            dir.y /= length;
-            physics->velocity = dir * ai->chaseSpeed;
+    // Counting sort of the batch by tree id into treeOrder
+    void groupByTree() {
+        size_t trees = BehaviorTreeLibrary::instance().size();
+        treeStart.assign(trees + 1, 0);
+        for (Entity* entity : batchEntities) {
+            ++treeStart[treeOf(*entity, trees) + 1];
+        }
+        for (size_t t = 1; t < treeStart.size(); ++t) {
+            treeStart[t] += treeStart[t - 1];
+        }
+        treeOrder.resize(batchEntities.size());
+        treeCursor.assign(treeStart.begin(), treeStart.end() - 1);
+        for (size_t i = 0; i < batchEntities.size(); ++i) {
+            treeOrder[treeCursor[treeOf(*batchEntities[i], trees)]++] = static_cast<std::uint32_t>(i);
         }
     }
+
+    static size_t treeOf(Entity& entity, size_t trees) {
+        std::uint16_t tree = entity.getComponent<AIComponent>()->tree;
+        return tree < trees ? tree : 0;
+    }
+
+    void applyDecision(Entity& entity, size_t i, const BehaviorTree& behavior, sf::Vector2f playerPos) {
+        auto* ai = entity.getComponent<AIComponent>();
+        auto* physics = entity.getComponent<PhysicsComponent>();
+
+        ai->isChasing = batch.chasing[i] != 0;
+        for (float& timer : ai->blackboard) timer -= ai->sinceDecision;
+
+        BTContext context{*ai, *physics, batch, i, playerPos, rng};
+        runBehavior(behavior, context);
+
+        float distance2 = batch.distance2[i];
+        if (ai->isChasing || distance2 < FULL_RATE_RADIUS * FULL_RATE_RADIUS) {
+            ai->lod = AILod::Full;
+        } else {
+            ai->lod = distance2 < HALF_RATE_RADIUS * HALF_RATE_RADIUS ? AILod::Half : AILod::Quarter;
+        }
+        ai->overdue = false;
+        ai->sinceDecision = 0.f;
+    }
+
+    util::Pcg32 rng;
+    std::uint32_t tick = 0;
+    std::chrono::microseconds budget = DEFAULT_BUDGET;
+    float nanosPerDecision = 0.f;
+    Stats stats;
+    LineOfSight* lineOfSight = nullptr;
+    AIBatch batch;
+    std::vector<Entity*> batchEntities;
+    std::vector<Entity*> overdueAgents, dueAgents;  // Reduced-rate agents waiting on the allowance
+    std::vector<std::uint32_t> treeStart, treeCursor, treeOrder;
+};
+
+// Steering System - separation, alignment and cohesion between nearby agents
+class SteeringSystem {
+public:
+    void update(EntityManager& entities, float dt) {
+        agents.clear();
+        positions.clear();
+        velocities.clear();
+        float cellSize = 0.f;
+
+        entities.forEachWith<SteeringComponent, PhysicsComponent>([&](Entity& entity) {
+            auto* steering = entity.getComponent<SteeringComponent>();
+            agents.push_back(&entity);
+            positions.push_back(entity.position);
+            velocities.push_back(entity.getComponent<PhysicsComponent>()->velocity);
+            cellSize = std::max({cellSize, steering->neighborRadius, steering->separationRadius});
+        });
+        if (agents.size() < 2) return;
+
+        grid.build(positions, cellSize);
+
+        // Forces use the start-of-tick positions and velocities, so the
+        // result doesn't depend on the order agents are visited in
+        for (size_t i = 0; i < agents.size(); ++i) {
+            auto* steering = agents[i]->getComponent<SteeringComponent>();
+            auto* physics = agents[i]->getComponent<PhysicsComponent>();
+
+            physics->velocity += steer(i, *steering) * dt;
+
+            float speed2 = physics->velocity.x * physics->velocity.x + physics->velocity.y * physics->velocity.y;
+            if (speed2 > steering->maxSpeed * steering->maxSpeed) {
+                physics->velocity *= steering->maxSpeed / std::sqrt(speed2);
+            }
+        }
+    }
+
+    const NeighborGrid& getGrid() const { return grid; }
+
+private:
+    sf::Vector2f steer(size_t i, const SteeringComponent& steering) const {
+        sf::Vector2f self = positions[i];
+        float neighbor2 = steering.neighborRadius * steering.neighborRadius;
+        float separation2 = steering.separationRadius * steering.separationRadius;
+
+        sf::Vector2f push{0.f, 0.f}, velocitySum{0.f, 0.f}, positionSum{0.f, 0.f};
+        int neighbors = 0;
+
+        grid.forEachNear(self, [&](std::uint32_t j) {
+            if (j == i) return;
+            sf::Vector2f offset = self - positions[j];
+            float d2 = offset.x * offset.x + offset.y * offset.y;
+
+            if (d2 < separation2) {
+                if (d2 > 0.f) {
+                    float distance = std::sqrt(d2);
+                    push += offset / distance * (1.f - distance / steering.separationRadius);
+                } else {
+                    push.x += i < j ? -1.f : 1.f;  // Exactly stacked: split along x
+                }
+            }
+            if (d2 < neighbor2) {
+                velocitySum += velocities[j];
+                positionSum += positions[j];
+                ++neighbors;
+            }
+        });
+
+        sf::Vector2f force = push * steering.separationWeight;
+        if (neighbors > 0) {
+            float inv = 1.f / static_cast<float>(neighbors);
+            force += (velocitySum * inv - velocities[i]) * steering.alignmentWeight;
+            force += (positionSum * inv - self) * steering.cohesionWeight;
+        }
+        return force;
+    }
+
+    std::vector<Entity*> agents;
+    std::vector<sf::Vector2f> positions;
+    std::vector<sf::Vector2f> velocities;
+    NeighborGrid grid;
 };
 
 // Player Control System - handles input
 class PlayerControlSystem {
 public:
-    void update(EntityManager& entities, float dt) {
-        entities.forEachWith<PlayerControlComponent, PhysicsComponent>([dt](Entity& entity) {
+    explicit PlayerControlSystem(TimerWheel& clock) : clock(clock) {}
+
+    void update(EntityManager& entities, float /*dt*/) {
+        entities.forEachWith<PlayerControlComponent, PhysicsComponent>([this](Entity& entity) {
             auto* control = entity.getComponent<PlayerControlComponent>();
             auto* physics = entity.getComponent<PhysicsComponent>();
             auto* hitbox = entity.getComponent<HitboxComponent>();
@@ -132,30 +378,28 @@ public:
                 physics->velocity = {0.f, 0.f};
             }
 
-            // Attack input
-            control->cooldownTimer -= dt;
-            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Space) && control->cooldownTimer <= 0.f) {
+            // Attack input; both timers run on the game clock
+            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Space) && !control->cooldown.isPending()) {
                 control->isAttacking = true;
-                control->attackTimer = control->attackDuration;
-                control->cooldownTimer = control->attackCooldown;
                 if (hitbox) hitbox->active = true;
-            }
-
-            // Update attack timer
-            if (control->isAttacking) {
-                control->attackTimer -= dt;
-                if (control->attackTimer <= 0.f) {
+                control->attack.start(clock, control->attackDuration, [control, hitbox]() {
                     control->isAttacking = false;
                     if (hitbox) hitbox->active = false;
-                }
+                });
+                control->cooldown.start(clock, control->attackCooldown);
             }
         });
     }
+
+private:
+    TimerWheel& clock;
 };
 
 // Collision System - handles hitbox/hurtbox collisions
 class CollisionSystem {
 public:
+    explicit CollisionSystem(TimerWheel& clock) : clock(clock) {}
+
     void update(EntityManager& entities) {
         // Collect entities with hitboxes and hurtboxes
         std::vector<Entity*> attackers;
@@ -190,8 +434,8 @@ public:
                 auto* hurtbox = target->getComponent<HurtboxComponent>();
                 auto hurtBounds = hurtbox->getBounds(target->position);
 
-                if (hitBounds.findIntersection(hurtBounds)) {
-                    health->takeDamage(hitbox->damage);
+                if (util::overlapsDuringStep(hitBounds, lastMove(*attacker), hurtBounds, lastMove(*target))) {
+                    health->takeDamage(hitbox->damage, clock);
 
                     // Emit events
                     if (!health->isAlive()) {
@@ -213,20 +457,20 @@ public:
         }
 
         // Enemy contact damage to player
-        entities.forEachWith<EnemyTag, HurtboxComponent>([&entities](Entity& enemy) {
+        entities.forEachWith<EnemyTag, HurtboxComponent>([this, &entities](Entity& enemy) {
             auto* enemyHurtbox = enemy.getComponent<HurtboxComponent>();
             auto enemyBounds = enemyHurtbox->getBounds(enemy.position);
 
             entities.forEachWith<PlayerControlComponent, HurtboxComponent, HealthComponent>(
-                [&enemy, &enemyBounds](Entity& player) {
+                [this, &enemy, &enemyBounds, enemyMove = lastMove(enemy)](Entity& player) {
                     auto* playerHurtbox = player.getComponent<HurtboxComponent>();
                     auto* playerHealth = player.getComponent<HealthComponent>();
 
                     if (!playerHealth->isAlive() || playerHealth->isInvincible()) return;
 
                     auto playerBounds = playerHurtbox->getBounds(player.position);
-                    if (enemyBounds.findIntersection(playerBounds)) {
-                        playerHealth->takeDamage(1);
+                    if (util::overlapsDuringStep(enemyBounds, enemyMove, playerBounds, lastMove(player))) {
+                        playerHealth->takeDamage(1, clock);
 
                         // Apply knockback
                         sf::Vector2f dir = player.position - enemy.position;
@@ -247,11 +491,223 @@ public:
             );
         });
     }
+
+private:
+    // Fast movers are tested over their whole step, so nothing slips past a
+    // hitbox when a frame hitches or the simulation runs at coarse steps
+    static sf::Vector2f lastMove(const Entity& entity) {
+        const auto* physics = entity.getComponent<PhysicsComponent>();
+        return physics ? physics->lastMove : sf::Vector2f{0.f, 0.f};
+    }
+
+    TimerWheel& clock;
+};
+
+// Projectile System - ranged attacks. Projectiles live in a ProjectilePool
+// rather than as entities, and are tested against hurtboxes through a
+// per-tick TargetGrid, so cost grows with the number of projectiles only.
+class ProjectileSystem {
+public:
+    explicit ProjectileSystem(TimerWheel& clock) : clock(clock) {}
+
+    void setLineOfSight(LineOfSight* value) { lineOfSight = value; }
+
+    // Walls in grid stop projectiles and leaving bounds removes them.
+    // Projectiles in flight do not follow the player to another room.
+    void setRoom(const CollisionGrid* grid, const sf::FloatRect& bounds) {
+        collisionGrid = grid;
+        roomBounds = bounds;
+        pool.clear();
+    }
+
+    void update(EntityManager& entities, float dt, sf::Vector2f playerPos) {
+        fire(entities, playerPos);
+        if (pool.empty()) return;
+
+        gatherTargets(entities);
+
+        // Substeps keep every projectile's step shorter than any hurtbox
+        int substeps = static_cast<int>(std::ceil(pool.getMaxSpeed() * dt / MAX_STEP));
+        substeps = std::clamp(substeps, 1, MAX_SUBSTEPS);
+        float step = dt / substeps;
+        for (int i = 0; i < substeps && !pool.empty(); ++i) {
+            integrateProjectiles(pool, step);
+            resolve();
+        }
+    }
+
+    // All projectiles in one draw call
+    void render(sf::RenderWindow& window) {
+        if (pool.empty()) return;
+
+        vertices.resize(pool.size() * 6);
+        for (size_t i = 0; i < pool.size(); ++i) {
+            float x0 = pool.posX[i] - DRAW_RADIUS, x1 = pool.posX[i] + DRAW_RADIUS;
+            float y0 = pool.posY[i] - DRAW_RADIUS, y1 = pool.posY[i] + DRAW_RADIUS;
+            sf::Color color = pool.faction[i] == Faction::Player ? sf::Color(120, 220, 255) : sf::Color(255, 150, 40);
+
+            sf::Vertex* quad = &vertices[i * 6];
+            quad[0].position = {x0, y0};
+            quad[1].position = {x1, y0};
+            quad[2].position = {x1, y1};
+            quad[3].position = {x0, y0};
+            quad[4].position = {x1, y1};
+            quad[5].position = {x0, y1};
+            for (int v = 0; v < 6; ++v) quad[v].color = color;
+        }
+        window.draw(vertices);
+    }
+
+    ProjectilePool& getPool() { return pool; }
+
+    static constexpr float RADIUS = 3.f;  // Hurtboxes are grown by this for hit tests
+
+private:
+    struct Target {
+        Entity* entity;
+        HealthComponent* health;
+        Faction faction;
+    };
+
+    void fire(EntityManager& entities, sf::Vector2f playerPos) {
+        if (lineOfSight) lineOfSight->setTarget(playerPos);
+
+        entities.forEachWith<RangedAttackComponent, AIComponent>([this, playerPos](Entity& entity) {
+            auto* ranged = entity.getComponent<RangedAttackComponent>();
+            auto* ai = entity.getComponent<AIComponent>();
+            if (!ai->isChasing || ranged->reload.isPending()) return;
+            if (lineOfSight && !lineOfSight->canSee(entity.position)) return;
+
+            sf::Vector2f aim = playerPos - entity.position;
+            float length = std::sqrt(aim.x * aim.x + aim.y * aim.y);
+            if (length <= 0.f) return;
+
+            float heading = std::atan2(aim.y, aim.x) - ranged->spread * (ranged->shots - 1) / 2.f;
+            for (int shot = 0; shot < ranged->shots; ++shot, heading += ranged->spread) {
+                sf::Vector2f velocity{std::cos(heading) * ranged->projectileSpeed,
+                                      std::sin(heading) * ranged->projectileSpeed};
+                pool.spawn(entity.position, velocity, ranged->projectileLifetime, ranged->damage,
+                           Faction::Enemy, entity.getId());
+            }
+            ranged->reload.start(clock, ranged->reloadTime);
+        });
+    }
+
+    void gatherTargets(EntityManager& entities) {
+        targets.clear();
+        targetBoxes.clear();
+        entities.forEachWith<HurtboxComponent, HealthComponent>([this](Entity& entity) {
+            Faction faction;
+            if (entity.hasComponent<PlayerControlComponent>()) {
+                faction = Faction::Player;
+            } else if (entity.hasComponent<EnemyTag>()) {
+                faction = Faction::Enemy;
+            } else {
+                return;
+            }
+
+            auto bounds = entity.getComponent<HurtboxComponent>()->getBounds(entity.position);
+            bounds.position -= sf::Vector2f{RADIUS, RADIUS};
+            bounds.size += sf::Vector2f{2.f * RADIUS, 2.f * RADIUS};
+            targets.push_back({&entity, entity.getComponent<HealthComponent>(), faction});
+            targetBoxes.push_back(bounds);
+        });
+        targetGrid.build(targetBoxes, roomBounds, TARGET_CELL_SIZE);
+    }
+
+    // Removes projectiles that expired, left the room, hit a wall or hit an
+    // opposing target; removal swaps in the last one, so i is not advanced
+    void resolve() {
+        bool walls = collisionGrid && !collisionGrid->isEmpty();
+        sf::Vector2f wallOrigin = walls ? collisionGrid->getOrigin() : sf::Vector2f{};
+        sf::Vector2f tileSize = walls ? collisionGrid->getTileSize() : sf::Vector2f{1.f, 1.f};
+
+        for (size_t i = 0; i < pool.size();) {
+            float x = pool.posX[i], y = pool.posY[i];
+
+            bool gone = pool.life[i] <= 0.f || !roomBounds.contains({x, y});
+            if (!gone && walls) {
+                int col = static_cast<int>(std::floor((x - wallOrigin.x) / tileSize.x));
+                int row = static_cast<int>(std::floor((y - wallOrigin.y) / tileSize.y));
+                gone = collisionGrid->isBlocked(col, row, CollisionGrid::BLOCKS_FLYERS);
+            }
+
+            if (!gone) {
+                targetGrid.forEachAt(x, y, [&](std::uint32_t t) {
+                    const Target& target = targets[t];
+                    if (gone || target.faction == pool.faction[i] || !target.health->isAlive()) return;
+                    if (!targetBoxes[t].contains({x, y})) return;
+                    hit(target, pool.damage[i], pool.owner[i]);
+                    gone = true;
+                });
+            }
+
+            if (gone) {
+                pool.remove(i);
+            } else {
+                ++i;
+            }
+        }
+    }
+
+    // Invincible targets still absorb the projectile
+    void hit(const Target& target, int damage, unsigned int sourceId) {
+        if (target.health->isInvincible()) return;
+        target.health->takeDamage(damage, clock);
+
+        Entity& entity = *target.entity;
+        if (!target.health->isAlive()) {
+            if (target.faction == Faction::Enemy) {
+                entity.active = false;  // Mark for removal
+                EventBus::instance().emit<EnemyDiedEvent>(entity.getId(), entity.position.x, entity.position.y);
+            } else {
+                EventBus::instance().emit<PlayerDiedEvent>();
+            }
+        } else if (target.faction == Faction::Player) {
+            EventBus::instance().emit<PlayerDamagedEvent>(damage, sourceId);
+        }
+    }
+
+    static constexpr float MAX_STEP = 8.f;  // px per substep; hurtboxes are 28px and up
+    static constexpr int MAX_SUBSTEPS = 8;
+    static constexpr float TARGET_CELL_SIZE = 64.f;
+    static constexpr float DRAW_RADIUS = 4.f;
+
+    TimerWheel& clock;
+    ProjectilePool pool;
+    TargetGrid targetGrid;
+    std::vector<Target> targets;
+    std::vector<sf::FloatRect> targetBoxes;
+    const CollisionGrid* collisionGrid = nullptr;
+    sf::FloatRect roomBounds;
+    LineOfSight* lineOfSight = nullptr;
+    sf::VertexArray vertices{sf::PrimitiveType::Triangles};
+};
+
+// Status Effect System - applies derived stats when an entity's effects change
+class StatusEffectSystem {
+public:
+    void update(EntityManager& entities) {
+        entities.forEachWith<StatusEffectComponent>([](Entity& entity) {
+            auto* effects = entity.getComponent<StatusEffectComponent>();
+            if (!effects->dirty) return;
+            effects->dirty = false;
+
+            if (auto* physics = entity.getComponent<PhysicsComponent>()) {
+                physics->speed = effects->derived(Stat::MoveSpeed);
+            }
+            if (auto* hitbox = entity.getComponent<HitboxComponent>()) {
+                hitbox->damage = static_cast<int>(std::lround(effects->derived(Stat::Damage)));
+            }
+        });
+    }
 };
 
 // Pickup System - handles pickup collection
 class PickupSystem {
 public:
+    explicit PickupSystem(TimerWheel& clock) : clock(clock) {}
+
     void update(EntityManager& entities) {
         Entity* player = nullptr;
         entities.forEachWith<PlayerControlComponent>([&player](Entity& e) {
@@ -281,6 +737,8 @@ public:
                     if (health) {
                         health->current = std::min(health->current + pickupComp->value, health->max);
                     }
+                } else if (auto* effects = player->getComponent<StatusEffectComponent>()) {
+                    effects->apply(effectFor(*pickupComp), clock);
                 }
 
                 EventBus::instance().emit<PickupCollectedEvent>(
@@ -291,6 +749,26 @@ public:
             }
         });
     }
+
+    // Timed boosts granted by non-health pickups; value scales the strength
+    static StatusEffect effectFor(const PickupComponent& pickup) {
+        StatusEffect effect;
+        effect.kind = static_cast<std::uint8_t>(pickup.type);
+        effect.maxStacks = 3;
+        if (pickup.type == PickupType::SpeedBoost) {
+            effect.stat = Stat::MoveSpeed;
+            effect.multiply = 1.f + 0.25f * pickup.value;
+            effect.duration = 6.f;
+        } else {
+            effect.stat = Stat::Damage;
+            effect.add = static_cast<float>(pickup.value);
+            effect.duration = 10.f;
+        }
+        return effect;
+    }
+
+private:
+    TimerWheel& clock;
 };
 
 // Render System - draws all entities
@@ -304,11 +782,14 @@ public:
             shape.setOrigin(sprite->origin);
             shape.setPosition(entity.position);
             shape.setFillColor(sprite->color);
+            if (sprite->useTexture) {
+                shape.setTexture(&AssetManager::instance().getTexture(sprite->textureId));
+            }
 
             // Blink during invincibility
             auto* health = entity.getComponent<HealthComponent>();
             if (health && health->isInvincible()) {
-                if (static_cast<int>(health->invincibilityTimer * 10) % 2 == 0) {
+                if (static_cast<int>(health->invincibility.remaining() * 10) % 2 == 0) {
                     auto color = sprite->color;
                     color.a = 128;
                     shape.setFillColor(color);
@@ -335,14 +816,3 @@ public:
         });
     }
 };
-
-// Health System - updates invincibility timers
-class HealthSystem {
-public:
-    void update(EntityManager& entities, float dt) {
-        entities.forEachWith<HealthComponent>([dt](Entity& entity) {
-            auto* health = entity.getComponent<HealthComponent>();
-            health->update(dt);
-        });
-    }
-};
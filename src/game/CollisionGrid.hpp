@@ -0,0 +1,161 @@
+#pragma once
+
+#include "RoomTemplate.hpp"
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+// Static collision for a room's obstacles, built once from its layout.
+//
+// Each tile holds a mask of which movers it blocks. Movement is resolved one
+// axis at a time by scanning only the tiles the box's leading edge sweeps
+// across, so the cost per entity depends on how far it moves and how big it
+// is, never on how many obstacles the room has, and nothing tunnels through
+// a wall however large the step.
+class CollisionGrid {
+public:
+    enum Mask : std::uint8_t {
+        BLOCKS_WALKERS = 1 << 0,
+        BLOCKS_FLYERS = 1 << 1,
+        BLOCKS_SIGHT = 1 << 2,
+    };
+
+    CollisionGrid() = default;  // Blocks nothing
+
+    CollisionGrid(const RoomTemplate& layout, const sf::FloatRect& area)
+        : origin(area.position),
+          tileSize(area.size.x / RoomTemplate::COLS, area.size.y / RoomTemplate::ROWS) {
+        for (int i = 0; i < RoomTemplate::COLS * RoomTemplate::ROWS; ++i) {
+            switch (layout.tiles[i]) {
+                case TileType::Floor: cells[i] = 0; break;
+                case TileType::Wall:  cells[i] = BLOCKS_WALKERS | BLOCKS_FLYERS | BLOCKS_SIGHT; break;
+                case TileType::Pit:   cells[i] = BLOCKS_WALKERS; break;
+            }
+            if (cells[i]) empty = false;
+        }
+    }
+
+    // Outside the grid never blocks; the room clamp handles the outer walls
+    bool isBlocked(int col, int row, std::uint8_t mask) const {
+        if (col < 0 || col >= RoomTemplate::COLS || row < 0 || row >= RoomTemplate::ROWS) return false;
+        return (cells[row * RoomTemplate::COLS + col] & mask) != 0;
+    }
+
+    bool isEmpty() const { return empty; }
+    sf::Vector2f getOrigin() const { return origin; }
+    sf::Vector2f getTileSize() const { return tileSize; }
+
+    // Tile containing a point, clamped to the grid
+    sf::Vector2i cellAt(sf::Vector2f point) const {
+        return {std::clamp(column(point.x), 0, RoomTemplate::COLS - 1),
+                std::clamp(row(point.y), 0, RoomTemplate::ROWS - 1)};
+    }
+
+    bool overlaps(sf::Vector2f center, sf::Vector2f halfSize, std::uint8_t mask) const {
+        if (empty) return false;
+        int col0 = column(center.x - halfSize.x), col1 = column(center.x + halfSize.x - EPSILON);
+        int row0 = row(center.y - halfSize.y), row1 = row(center.y + halfSize.y - EPSILON);
+        for (int r = row0; r <= row1; ++r) {
+            for (int c = col0; c <= col1; ++c) {
+                if (isBlocked(c, r, mask)) return true;
+            }
+        }
+        return false;
+    }
+
+    struct MoveResult {
+        sf::Vector2f position;
+        bool hitX = false;
+        bool hitY = false;
+    };
+
+    // Moves a box (center, halfSize) by delta, stopping flush against the
+    // first blocking tile on each axis
+    MoveResult move(sf::Vector2f center, sf::Vector2f halfSize, sf::Vector2f delta, std::uint8_t mask) const {
+        MoveResult result{center + delta};
+        if (empty) return result;
+
+        result.position = center;
+        result.hitX = sweepX(result.position, halfSize, delta.x, mask);
+        result.hitY = sweepY(result.position, halfSize, delta.y, mask);
+        return result;
+    }
+
+private:
+    bool sweepX(sf::Vector2f& center, sf::Vector2f halfSize, float dx, std::uint8_t mask) const {
+        if (dx == 0.f) return false;
+        int row0 = row(center.y - halfSize.y), row1 = row(center.y + halfSize.y - EPSILON);
+
+        if (dx > 0.f) {
+            float edge = center.x + halfSize.x;
+            for (int c = column(edge - EPSILON) + 1, last = column(edge + dx - EPSILON); c <= last; ++c) {
+                if (columnBlocked(c, row0, row1, mask)) {
+                    center.x = origin.x + c * tileSize.x - halfSize.x;
+                    return true;
+                }
+            }
+        } else {
+            float edge = center.x - halfSize.x;
+            for (int c = column(edge) - 1, last = column(edge + dx); c >= last; --c) {
+                if (columnBlocked(c, row0, row1, mask)) {
+                    center.x = origin.x + (c + 1) * tileSize.x + halfSize.x;
+                    return true;
+                }
+            }
+        }
+        center.x += dx;
+        return false;
+    }
+
+    bool sweepY(sf::Vector2f& center, sf::Vector2f halfSize, float dy, std::uint8_t mask) const {
+        if (dy == 0.f) return false;
+        int col0 = column(center.x - halfSize.x), col1 = column(center.x + halfSize.x - EPSILON);
+
+        if (dy > 0.f) {
+            float edge = center.y + halfSize.y;
+            for (int r = row(edge - EPSILON) + 1, last = row(edge + dy - EPSILON); r <= last; ++r) {
+                if (rowBlocked(r, col0, col1, mask)) {
+                    center.y = origin.y + r * tileSize.y - halfSize.y;
+                    return true;
+                }
+            }
+        } else {
+            float edge = center.y - halfSize.y;
+            for (int r = row(edge) - 1, last = row(edge + dy); r >= last; --r) {
+                if (rowBlocked(r, col0, col1, mask)) {
+                    center.y = origin.y + (r + 1) * tileSize.y + halfSize.y;
+                    return true;
+                }
+            }
+        }
+        center.y += dy;
+        return false;
+    }
+
+    bool columnBlocked(int col, int row0, int row1, std::uint8_t mask) const {
+        for (int r = row0; r <= row1; ++r) {
+            if (isBlocked(col, r, mask)) return true;
+        }
+        return false;
+    }
+
+    bool rowBlocked(int r, int col0, int col1, std::uint8_t mask) const {
+        for (int c = col0; c <= col1; ++c) {
+            if (isBlocked(c, r, mask)) return true;
+        }
+        return false;
+    }
+
+    int column(float x) const { return static_cast<int>(std::floor((x - origin.x) / tileSize.x)); }
+    int row(float y) const { return static_cast<int>(std::floor((y - origin.y) / tileSize.y)); }
+
+    // Boxes exactly touching a tile edge don't count as inside it
+    static constexpr float EPSILON = 0.001f;
+
+    std::array<std::uint8_t, RoomTemplate::COLS * RoomTemplate::ROWS> cells{};
+    sf::Vector2f origin{0.f, 0.f};
+    sf::Vector2f tileSize{1.f, 1.f};
+    bool empty = true;
+};
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "../ecs/EntityManager.hpp"
+#include "../ecs/EntityFactory.hpp"
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+// Compact, trivially copyable record of one non-player entity, kept by a
+// Room while the player is elsewhere.
+struct EntitySnapshot {
+    enum class Kind : std::uint8_t { Enemy, Pickup };
+
+    Kind kind;
+    std::uint8_t type;      // EntityFactory::EnemyType or PickupType
+    bool chasing;
+    std::int16_t health;    // Enemy health, or pickup value
+    sf::Vector2f position;
+    sf::Vector2f velocity;
+    std::array<float, AIComponent::BLACKBOARD_SLOTS> blackboard;
+};
+
+static_assert(std::is_trivially_copyable_v<EntitySnapshot>, "EntitySnapshot must stay POD");
+
+// Records every live enemy and uncollected pickup; the player is skipped
+inline std::vector<EntitySnapshot> captureEntities(EntityManager& entities) {
+    std::vector<EntitySnapshot> snapshots;
+
+    entities.forEach([&snapshots](Entity& entity) {
+        if (auto* tag = entity.getComponent<EnemyTag>()) {
+            auto* health = entity.getComponent<HealthComponent>();
+            if (health && !health->isAlive()) return;
+
+            EntitySnapshot snapshot{};
+            snapshot.kind = EntitySnapshot::Kind::Enemy;
+            snapshot.type = static_cast<std::uint8_t>(tag->type);
+            snapshot.position = entity.position;
+            if (health) snapshot.health = static_cast<std::int16_t>(health->current);
+            if (auto* physics = entity.getComponent<PhysicsComponent>()) snapshot.velocity = physics->velocity;
+            if (auto* ai = entity.getComponent<AIComponent>()) {
+                snapshot.blackboard = ai->blackboard;
+                snapshot.chasing = ai->isChasing;
+            }
+            snapshots.push_back(snapshot);
+        } else if (auto* pickup = entity.getComponent<PickupComponent>()) {
+            if (pickup->collected) return;
+
+            EntitySnapshot snapshot{};
+            snapshot.kind = EntitySnapshot::Kind::Pickup;
+            snapshot.type = static_cast<std::uint8_t>(pickup->type);
+            snapshot.health = static_cast<std::int16_t>(pickup->value);
+            snapshot.position = entity.position;
+            snapshots.push_back(snapshot);
+        }
+    });
+
+    return snapshots;
+}
+
+// Re-creates captured entities with the state they were left in
+inline void restoreEntities(EntityManager& entities, const std::vector<EntitySnapshot>& snapshots,
+                            const sf::FloatRect& roomBounds) {
+    for (const auto& snapshot : snapshots) {
+        if (snapshot.kind == EntitySnapshot::Kind::Enemy) {
+            auto type = static_cast<EntityFactory::EnemyType>(snapshot.type);
+            Entity& enemy = EntityFactory::createEnemy(entities, type, snapshot.position, roomBounds);
+            enemy.getComponent<HealthComponent>()->current = snapshot.health;
+            enemy.getComponent<PhysicsComponent>()->velocity = snapshot.velocity;
+            auto* ai = enemy.getComponent<AIComponent>();
+            ai->blackboard = snapshot.blackboard;
+            ai->isChasing = snapshot.chasing;
+        } else {
+            EntityFactory::createPickup(entities, static_cast<PickupType>(snapshot.type), snapshot.health,
+                                        snapshot.position);
+        }
+    }
+}
@@ -1,32 +1,40 @@
 #pragma once
 
 #include "Room.hpp"
+#include "GridMap.hpp"
 #include "../util/Random.hpp"
 #include <vector>
 #include <memory>
-#include <map>
 #include <algorithm>
 
-struct GridPos {
-    int x, y;
-
-    bool operator==(const GridPos& other) const {
-        return x == other.x && y == other.y;
-    }
-};
-
 class Floor {
 public:
     Floor(int floorNumber, sf::Vector2f roomSize)
-        : floorNumber(floorNumber), roomSize(roomSize) {
+        : Floor(floorNumber, roomSize, defaultRoomCount(floorNumber)) {}
+
+    // Explicit room count, e.g. for endurance floors
+    Floor(int floorNumber, sf::Vector2f roomSize, int roomCount)
+        : Floor(floorNumber, roomSize, roomCount, util::randomSeed()) {}
+
+    // Same seed, same layout
+    Floor(int floorNumber, sf::Vector2f roomSize, int roomCount, std::uint64_t seed)
+        : floorNumber(floorNumber), roomSize(roomSize), roomCount(roomCount), seed(seed) {
         generate();
     }
 
+    static int defaultRoomCount(int floorNumber) {
+        return 4 + floorNumber;  // More rooms on later floors
+    }
+
     void generate() {
         rooms.clear();
         grid.clear();
+        roomPositions.clear();
+        rooms.reserve(roomCount);
+        roomPositions.reserve(roomCount);
+        grid.reserve(roomCount);
 
-        int roomCount = 4 + floorNumber;  // More rooms on later floors
+        util::Pcg32 rng = util::makeRng(seed, util::RngStream::Layout);
         int nextId = 0;
 
         // Start room at center
@@ -34,16 +42,15 @@ public:
         auto& startRoom = createRoom(nextId++, RoomType::Start, startPos);
 
         // Generate connected rooms
-        std::vector<GridPos> frontier;
+        Frontier frontier;
+        frontier.index.reserve(roomCount * 2);
         addNeighborsToFrontier(startPos, frontier);
 
-        while (rooms.size() < static_cast<size_t>(roomCount) && !frontier.empty()) {
+        while (rooms.size() < static_cast<size_t>(roomCount) && !frontier.cells.empty()) {
             // Pick random frontier position
-            int idx = util::randomInt(0, static_cast<int>(frontier.size()) - 1);
-            GridPos pos = frontier[idx];
-            frontier.erase(frontier.begin() + idx);
-
-            if (grid.find(posKey(pos)) != grid.end()) continue;
+            int idx = static_cast<int>(rng.nextBounded(static_cast<std::uint32_t>(frontier.cells.size())));
+            GridPos pos = frontier.cells[idx];
+            frontier.removeAt(idx);
 
             // Create combat room
             createRoom(nextId++, RoomType::Combat, pos);
@@ -54,45 +61,36 @@ public:
             addNeighborsToFrontier(pos, frontier);
         }
 
-        // Find furthest room from start and make it the exit
-        int furthestId = findFurthestRoom(startPos);
+        // The room furthest from the start through doors becomes the exit
+        int furthestId = assignDepths();
+        exitRoomId = -1;
         if (furthestId > 0) {
-            for (auto& room : rooms) {
-                if (room->getId() == furthestId) {
-                    // Replace with exit room
-                    GridPos exitPos = roomPositions[furthestId];
-                    rooms.erase(std::remove_if(rooms.begin(), rooms.end(),
-                        [furthestId](const auto& r) { return r->getId() == furthestId; }),
-                        rooms.end());
-
-                    createRoom(furthestId, RoomType::Exit, exitPos);
-                    connectToNeighbors(exitPos);
-                    break;
-                }
-            }
+            // Replace with exit room, keeping its slot so ids still index rooms
+            int depth = rooms[furthestId]->getDepth();
+            rooms[furthestId] = std::make_unique<Room>(furthestId, RoomType::Exit, roomSize);
+            rooms[furthestId]->setDepth(depth);
+            connectToNeighbors(roomPositions[furthestId]);
+            exitRoomId = furthestId;
         }
 
+        rollSpawnPlans();
         currentRoomId = 0;
     }
 
-    Room* getCurrentRoom() {
-        for (auto& room : rooms) {
-            if (room->getId() == currentRoomId) {
-                return room.get();
-            }
-        }
-        return nullptr;
-    }
+    Room* getCurrentRoom() { return getRoom(currentRoomId); }
 
+    // Room ids are assigned densely from 0 and double as indices into rooms
     Room* getRoom(int id) {
-        for (auto& room : rooms) {
-            if (room->getId() == id) {
-                return room.get();
-            }
-        }
-        return nullptr;
+        return id >= 0 && id < static_cast<int>(rooms.size()) ? rooms[id].get() : nullptr;
     }
 
+    const Room* getRoom(int id) const {
+        return id >= 0 && id < static_cast<int>(rooms.size()) ? rooms[id].get() : nullptr;
+    }
+
+    // Room id at a grid cell, or -1
+    int getRoomAt(GridPos pos) const { return grid.find(pos); }
+
     bool transitionToRoom(int targetId, Direction fromDirection) {
         Room* target = getRoom(targetId);
         if (!target) return false;
@@ -108,14 +106,7 @@ public:
             return {roomSize.x / 2.f, roomSize.y / 2.f};
         }
 
-        Room* room = nullptr;
-        for (const auto& r : rooms) {
-            if (r->getId() == currentRoomId) {
-                room = r.get();
-                break;
-            }
-        }
-        if (room) {
+        if (const Room* room = getRoom(currentRoomId)) {
             return room->getSpawnFromDoor(entryDirection);
         }
         return {roomSize.x / 2.f, roomSize.y / 2.f};
@@ -123,21 +114,27 @@ public:
 
     int getFloorNumber() const { return floorNumber; }
     int getCurrentRoomId() const { return currentRoomId; }
+    int getExitRoomId() const { return exitRoomId; }
+    std::uint64_t getSeed() const { return seed; }
+
+    // Seed for everything rolled inside a room (spawns, loot, AI), so
+    // re-entering a room or replaying a run rolls the same way
+    std::uint64_t getRoomSeed(int id) const { return util::deriveSeed(seed, static_cast<std::uint64_t>(id)); }
     const std::vector<std::unique_ptr<Room>>& getRooms() const { return rooms; }
-    const std::map<int, GridPos>& getRoomPositions() const { return roomPositions; }
+    const std::vector<GridPos>& getRoomPositions() const { return roomPositions; }  // Indexed by room id
 
 private:
     Room& createRoom(int id, RoomType type, GridPos pos) {
         auto room = std::make_unique<Room>(id, type, roomSize);
         Room& ref = *room;
-        grid[posKey(pos)] = id;
-        roomPositions[id] = pos;
+        grid.insert(pos, id);
+        roomPositions.push_back(pos);  // Ids ascend from 0, so this is roomPositions[id]
         rooms.push_back(std::move(room));
         return ref;
     }
 
     void connectToNeighbors(GridPos pos) {
-        Room* room = getRoom(grid[posKey(pos)]);
+        Room* room = getRoom(grid.find(pos));
         if (!room) return;
 
         // Check each direction
@@ -151,9 +148,8 @@ private:
         Direction opposite[] = {Direction::South, Direction::North, Direction::West, Direction::East};
 
         for (int i = 0; i < 4; ++i) {
-            auto it = grid.find(posKey(neighbors[i]));
-            if (it != grid.end()) {
-                int neighborId = it->second;
+            int neighborId = grid.find(neighbors[i]);
+            if (neighborId != GridMap::NONE) {
                 room->connectDoor(dirs[i], neighborId);
 
                 // Connect the other direction too
@@ -165,7 +161,24 @@ private:
         }
     }
 
-    void addNeighborsToFrontier(GridPos pos, std::vector<GridPos>& frontier) {
+    // Empty cells next to the layout, as a vector for O(1) random picks plus
+    // a cell -> slot index for O(1) membership and swap-removal
+    struct Frontier {
+        std::vector<GridPos> cells;
+        GridMap index;
+
+        void removeAt(int idx) {
+            // The removed cell is about to become a room, and room cells are
+            // never looked up here, so its stale index entry is harmless
+            cells[idx] = cells.back();
+            cells.pop_back();
+            if (idx < static_cast<int>(cells.size())) {
+                index.insert(cells[idx], idx);
+            }
+        }
+    };
+
+    void addNeighborsToFrontier(GridPos pos, Frontier& frontier) {
         GridPos neighbors[] = {
             {pos.x, pos.y - 1},
             {pos.x, pos.y + 1},
@@ -174,45 +187,102 @@ private:
         };
 
         for (const auto& n : neighbors) {
-            if (grid.find(posKey(n)) == grid.end()) {
-                // Check not already in frontier
-                bool found = false;
-                for (const auto& f : frontier) {
-                    if (f == n) { found = true; break; }
-                }
-                if (!found) {
-                    frontier.push_back(n);
+            if (!grid.contains(n) && !frontier.index.contains(n)) {
+                frontier.index.insert(n, static_cast<int>(frontier.cells.size()));
+                frontier.cells.push_back(n);
+            }
+        }
+    }
+
+    // Picks every combat room's layout and pre-rolls its enemies from the
+    // room's spawn stream, so entering a room only creates entities
+    void rollSpawnPlans() {
+        const RoomTemplateLibrary& library = RoomTemplateLibrary::instance();
+        int minEnemies = 2 + floorNumber / 2;
+        int maxEnemies = 4 + floorNumber / 2;
+        std::vector<std::uint16_t> cells;
+
+        for (auto& room : rooms) {
+            if (room->getType() != RoomType::Combat) continue;
+
+            util::Pcg32 rng = util::makeRng(getRoomSeed(room->getId()), util::RngStream::Spawns);
+            const RoomTemplate& layout = library.pick(rng);
+            room->setLayout(layout);
+
+            int count = rng.nextInt(minEnemies, maxEnemies);
+            cells = layout.spawnCells;
+            sf::Vector2f tile = room->getTileSize();
+
+            std::vector<SpawnPoint> plan;
+            plan.reserve(count);
+            for (int i = 0; i < count; ++i) {
+                int cell;
+                if (!cells.empty()) {
+                    // Marked spawn points first, each used once
+                    std::uint32_t pick = rng.nextBounded(static_cast<std::uint32_t>(cells.size()));
+                    cell = cells[pick];
+                    cells[pick] = cells.back();
+                    cells.pop_back();
+                } else {
+                    cell = randomFloorCell(layout, rng);
                 }
+
+                sf::Vector2f corner = room->getTilePosition(cell % RoomTemplate::COLS, cell / RoomTemplate::COLS);
+                sf::Vector2f position = corner + sf::Vector2f{tile.x / 2.f, tile.y / 2.f};
+                plan.push_back({layout.pickEnemy(rng), position});
             }
+            room->setSpawnPlan(std::move(plan));
+        }
+    }
+
+    // Any floor tile away from the walls around the doors
+    static int randomFloorCell(const RoomTemplate& layout, util::Pcg32& rng) {
+        for (;;) {
+            int col = rng.nextInt(1, RoomTemplate::COLS - 2);
+            int row = rng.nextInt(1, RoomTemplate::ROWS - 2);
+            if (layout.at(col, row) == TileType::Floor) return row * RoomTemplate::COLS + col;
         }
     }
 
-    int findFurthestRoom(GridPos start) {
+    // Breadth-first search over doors from the start room. Stores each
+    // room's depth and returns the deepest room (lowest id on ties).
+    int assignDepths() {
+        std::vector<int> queue;
+        queue.reserve(rooms.size());
+        for (auto& room : rooms) room->setDepth(-1);
+
+        rooms[0]->setDepth(0);
+        queue.push_back(0);
         int furthestId = 0;
-        int maxDist = 0;
 
-        for (const auto& [id, pos] : roomPositions) {
-            int dist = std::abs(pos.x - start.x) + std::abs(pos.y - start.y);
-            if (dist > maxDist) {
-                maxDist = dist;
-                furthestId = id;
+        for (size_t head = 0; head < queue.size(); ++head) {
+            Room* room = rooms[queue[head]].get();
+            for (const auto& door : room->getDoors()) {
+                Room* next = getRoom(door.targetRoomId);
+                if (!next || next->getDepth() >= 0) continue;
+
+                next->setDepth(room->getDepth() + 1);
+                queue.push_back(next->getId());
+                if (next->getDepth() > rooms[furthestId]->getDepth() ||
+                    (next->getDepth() == rooms[furthestId]->getDepth() && next->getId() < furthestId)) {
+                    furthestId = next->getId();
+                }
             }
         }
 
         return furthestId;
     }
 
-    static std::string posKey(GridPos pos) {
-        return std::to_string(pos.x) + "," + std::to_string(pos.y);
-    }
-
     int floorNumber;
     sf::Vector2f roomSize;
-    std::vector<std::unique_ptr<Room>> rooms;
-    std::map<std::string, int> grid;  // "x,y" -> roomId
-    std::map<int, GridPos> roomPositions;  // roomId -> position
+    int roomCount;
+    std::uint64_t seed;
+    std::vector<std::unique_ptr<Room>> rooms;  // Indexed by room id
+    GridMap grid;  // Position -> roomId
+    std::vector<GridPos> roomPositions;  // Indexed by room id, like rooms
 
     int currentRoomId = 0;
     int previousRoomId = -1;
+    int exitRoomId = -1;
     Direction entryDirection = Direction::South;
 };
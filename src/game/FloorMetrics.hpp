@@ -0,0 +1,70 @@
+#pragma once
+
+#include "Floor.hpp"
+#include <cstdint>
+
+// Layout properties of a generated floor, used to find seeds for daily
+// challenges and regression tests
+struct FloorMetrics {
+    std::uint16_t roomCount = 0;
+    std::uint16_t exitDepth = 0;    // Doors between start and exit
+    std::uint16_t deadEnds = 0;     // Rooms with a single door, start excluded
+    std::uint16_t branchRooms = 0;  // Rooms with three or more doors
+};
+
+inline FloorMetrics computeFloorMetrics(const Floor& floor) {
+    FloorMetrics metrics;
+    metrics.roomCount = static_cast<std::uint16_t>(floor.getRooms().size());
+
+    if (const Room* exit = floor.getRoom(floor.getExitRoomId())) {
+        metrics.exitDepth = static_cast<std::uint16_t>(exit->getDepth());
+    }
+
+    for (const auto& room : floor.getRooms()) {
+        int doors = 0;
+        for (const auto& door : room->getDoors()) {
+            if (door.targetRoomId >= 0) ++doors;
+        }
+        if (doors == 1 && room->getType() != RoomType::Start) ++metrics.deadEnds;
+        if (doors >= 3) ++metrics.branchRooms;
+    }
+    return metrics;
+}
+
+// One record of a seed index file. Records are fixed-size and stored sorted
+// by (exitDepth, roomCount, deadEnds, branchRooms, seed), so the file can be
+// binary-searched on exit depth and merged with other sorted indexes.
+struct SeedIndexRecord {
+    std::uint64_t seed;
+    FloorMetrics metrics;
+
+    bool operator<(const SeedIndexRecord& other) const {
+        if (metrics.exitDepth != other.metrics.exitDepth) return metrics.exitDepth < other.metrics.exitDepth;
+        if (metrics.roomCount != other.metrics.roomCount) return metrics.roomCount < other.metrics.roomCount;
+        if (metrics.deadEnds != other.metrics.deadEnds) return metrics.deadEnds < other.metrics.deadEnds;
+        if (metrics.branchRooms != other.metrics.branchRooms) return metrics.branchRooms < other.metrics.branchRooms;
+        return seed < other.seed;
+    }
+};
+
+static_assert(sizeof(SeedIndexRecord) == 16, "SeedIndexRecord layout changed");
+
+// Inclusive range constraints on each metric
+struct FloorQuery {
+    struct Range {
+        int min = 0;
+        int max = 0xFFFF;
+
+        bool contains(int value) const { return value >= min && value <= max; }
+    };
+
+    Range roomCount;
+    Range exitDepth;
+    Range deadEnds;
+    Range branchRooms;
+
+    bool matches(const FloorMetrics& metrics) const {
+        return roomCount.contains(metrics.roomCount) && exitDepth.contains(metrics.exitDepth) &&
+               deadEnds.contains(metrics.deadEnds) && branchRooms.contains(metrics.branchRooms);
+    }
+};
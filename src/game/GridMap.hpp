@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+struct GridPos {
+    int x, y;
+
+    bool operator==(const GridPos& other) const {
+        return x == other.x && y == other.y;
+    }
+};
+
+// Flat open-addressing hash map from grid cell to an int (a room id).
+// Cells are packed into one 64-bit key, so a probe is a multiply, a mask and
+// usually a single cache line, with no allocation.
+class GridMap {
+public:
+    static constexpr int NONE = -1;
+
+    GridMap() { slots.resize(MIN_CAPACITY); }
+
+    void clear() {
+        slots.assign(MIN_CAPACITY, Slot{});
+        count = 0;
+    }
+
+    void reserve(size_t cells) {
+        size_t capacity = slots.size();
+        while (cells * 2 > capacity) capacity *= 2;
+        if (capacity != slots.size()) rehash(capacity);
+    }
+
+    // Inserts or overwrites; value must not be NONE
+    void insert(GridPos pos, int value) {
+        if ((count + 1) * 2 > slots.size()) rehash(slots.size() * 2);
+
+        std::uint64_t key = pack(pos);
+        size_t i = probeStart(key);
+        while (slots[i].value != NONE && slots[i].key != key) {
+            i = (i + 1) & (slots.size() - 1);
+        }
+        if (slots[i].value == NONE) ++count;
+        slots[i] = {key, value};
+    }
+
+    // Returns NONE if the cell is empty
+    int find(GridPos pos) const {
+        std::uint64_t key = pack(pos);
+        for (size_t i = probeStart(key);; i = (i + 1) & (slots.size() - 1)) {
+            if (slots[i].value == NONE) return NONE;
+            if (slots[i].key == key) return slots[i].value;
+        }
+    }
+
+    bool contains(GridPos pos) const { return find(pos) != NONE; }
+    size_t size() const { return count; }
+
+private:
+    struct Slot {
+        std::uint64_t key = 0;
+        int value = NONE;
+    };
+
+    static std::uint64_t pack(GridPos pos) {
+        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(pos.x)) << 32) |
+               static_cast<std::uint32_t>(pos.y);
+    }
+
+    // Fibonacci hashing spreads neighbouring cells across the table
+    size_t probeStart(std::uint64_t key) const {
+        return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> 32) & (slots.size() - 1);
+    }
+
+    void rehash(size_t capacity) {
+        std::vector<Slot> old = std::move(slots);
+        slots.assign(capacity, Slot{});
+        for (const auto& slot : old) {
+            if (slot.value == NONE) continue;
+            size_t i = probeStart(slot.key);
+            while (slots[i].value != NONE) i = (i + 1) & (capacity - 1);
+            slots[i] = slot;
+        }
+    }
+
+    static constexpr size_t MIN_CAPACITY = 16;
+
+    std::vector<Slot> slots;  // Power-of-two size, at most half full
+    size_t count = 0;
+};
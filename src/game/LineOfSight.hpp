@@ -0,0 +1,102 @@
+#pragma once
+
+#include "CollisionGrid.hpp"
+#include "RoomTemplate.hpp"
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+
+// Line-of-sight queries against one target (the player) over a room's tile
+// grid. Rays are traced tile by tile (DDA) from the centre of the viewer's
+// tile to the centre of the target's tile, so every viewer standing in the
+// same tile shares one answer. Answers are cached per tile and only thrown
+// away when the target moves to another tile or the grid changes.
+class LineOfSight {
+public:
+    void setGrid(const CollisionGrid* value) {
+        grid = value;
+        invalidate();
+    }
+
+    // Call once per tick before querying
+    void setTarget(sf::Vector2f position) {
+        if (!grid) return;
+        sf::Vector2i cell = grid->cellAt(position);
+        if (cell != targetCell) {
+            targetCell = cell;
+            invalidate();
+        }
+    }
+
+    bool canSee(sf::Vector2f from) {
+        if (!grid || grid->isEmpty()) return true;
+
+        sf::Vector2i cell = grid->cellAt(from);
+        std::uint8_t& entry = cache[cell.y * RoomTemplate::COLS + cell.x];
+        if (entry == UNKNOWN) {
+            ++raycasts;
+            entry = traceClear(cell, targetCell) ? VISIBLE : HIDDEN;
+        }
+        return entry == VISIBLE;
+    }
+
+    // Rays actually traced since construction, for profiling and tests
+    size_t getRaycastCount() const { return raycasts; }
+
+private:
+    // Amanatides & Woo: visits every tile the segment between the two tile
+    // centres passes through, stopping at the first one that blocks sight
+    bool traceClear(sf::Vector2i from, sf::Vector2i to) const {
+        if (grid->isBlocked(from.x, from.y, CollisionGrid::BLOCKS_SIGHT)) return false;
+
+        int stepX = to.x > from.x ? 1 : (to.x < from.x ? -1 : 0);
+        int stepY = to.y > from.y ? 1 : (to.y < from.y ? -1 : 0);
+        int spanX = std::abs(to.x - from.x);
+        int spanY = std::abs(to.y - from.y);
+
+        // Distance along the segment to the next column/row boundary, scaled
+        // by 2 * spanX * spanY so it stays an exact integer: the ray starts at
+        // a centre, so the first boundary is half a tile out
+        const int NEVER = std::numeric_limits<int>::max();
+        int deltaX = 2 * spanY, deltaY = 2 * spanX;
+        int nextX = stepX ? spanY : NEVER;
+        int nextY = stepY ? spanX : NEVER;
+
+        sf::Vector2i cell = from;
+        while (cell != to) {
+            if (nextX < nextY) {
+                cell.x += stepX;
+                nextX += deltaX;
+            } else if (nextY < nextX) {
+                cell.y += stepY;
+                nextY += deltaY;
+            } else {
+                // Through a corner exactly: blocked if either side is
+                if (grid->isBlocked(cell.x + stepX, cell.y, CollisionGrid::BLOCKS_SIGHT) ||
+                    grid->isBlocked(cell.x, cell.y + stepY, CollisionGrid::BLOCKS_SIGHT)) {
+                    return false;
+                }
+                cell.x += stepX;
+                cell.y += stepY;
+                nextX += deltaX;
+                nextY += deltaY;
+            }
+            if (grid->isBlocked(cell.x, cell.y, CollisionGrid::BLOCKS_SIGHT)) return false;
+        }
+        return true;
+    }
+
+    void invalidate() { cache.fill(UNKNOWN); }
+
+    static constexpr std::uint8_t UNKNOWN = 0;
+    static constexpr std::uint8_t VISIBLE = 1;
+    static constexpr std::uint8_t HIDDEN = 2;
+
+    const CollisionGrid* grid = nullptr;
+    sf::Vector2i targetCell{-1, -1};
+    std::array<std::uint8_t, RoomTemplate::COLS * RoomTemplate::ROWS> cache{};
+    size_t raycasts = 0;
+};
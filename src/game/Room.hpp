@@ -1,9 +1,13 @@
 #pragma once
 
+#include "EntitySnapshot.hpp"
+#include "RoomTemplate.hpp"
+#include "CollisionGrid.hpp"
 #include "../ecs/EntityManager.hpp"
 #include "../ecs/EntityFactory.hpp"
 #include "../core/EventBus.hpp"
 #include "../util/Random.hpp"
+#include "../util/Sweep.hpp"
 #include <SFML/Graphics.hpp>
 #include <vector>
 #include <functional>
@@ -21,10 +25,17 @@ struct Door {
 
 enum class RoomType { Start, Combat, Exit };
 
+// An enemy to create when the room is entered, rolled during floor generation
+struct SpawnPoint {
+    EntityFactory::EnemyType type;
+    sf::Vector2f position;
+};
+
 class Room {
 public:
     Room(int id, RoomType type, sf::Vector2f size)
-        : id(id), type(type), size(size), bounds({40.f, 40.f}, {size.x - 80.f, size.y - 80.f}) {
+        : id(id), type(type), size(size), bounds({40.f, 40.f}, {size.x - 80.f, size.y - 80.f}),
+          layout(&RoomTemplateLibrary::instance().getOpen()) {
         setupDoors();
     }
 
@@ -61,6 +72,19 @@ public:
         roomShape.setOutlineThickness(4.f);
         window.draw(roomShape);
 
+        // Draw obstacles
+        sf::Vector2f tile = getTileSize();
+        sf::RectangleShape tileShape(tile);
+        for (int row = 0; row < RoomTemplate::ROWS; ++row) {
+            for (int col = 0; col < RoomTemplate::COLS; ++col) {
+                TileType t = layout->at(col, row);
+                if (t == TileType::Floor) continue;
+                tileShape.setPosition(getTilePosition(col, row));
+                tileShape.setFillColor(t == TileType::Wall ? sf::Color(95, 95, 110) : sf::Color(20, 20, 25));
+                window.draw(tileShape);
+            }
+        }
+
         // Draw doors
         for (const auto& door : doors) {
             if (door.targetRoomId < 0) continue;  // No connection
@@ -85,11 +109,14 @@ public:
         }
     }
 
-    Door* checkDoorCollision(sf::Vector2f playerPos, sf::Vector2f playerSize) {
+    // playerMove is the player's displacement this step, so a fast player
+    // crossing a doorway between two frames still triggers it
+    Door* checkDoorCollision(sf::Vector2f playerPos, sf::Vector2f playerSize, sf::Vector2f playerMove = {0.f, 0.f}) {
         sf::FloatRect playerBounds({playerPos.x - playerSize.x / 2.f, playerPos.y - playerSize.y / 2.f}, playerSize);
 
         for (auto& door : doors) {
-            if (door.targetRoomId >= 0 && !door.locked && playerBounds.findIntersection(door.bounds)) {
+            if (door.targetRoomId >= 0 && !door.locked &&
+                util::overlapsDuringStep(playerBounds, playerMove, door.bounds, {0.f, 0.f})) {
                 return &door;
             }
         }
@@ -127,6 +154,41 @@ public:
     int getId() const { return id; }
     RoomType getType() const { return type; }
     bool isCleared() const { return cleared; }
+
+    // Doors between this room and the start room, set by Floor
+    int getDepth() const { return depth; }
+    void setDepth(int value) { depth = value; }
+
+    // Obstacle layout; templates live in RoomTemplateLibrary for the whole run
+    const RoomTemplate& getLayout() const { return *layout; }
+    void setLayout(const RoomTemplate& value) {
+        layout = &value;
+        collisionGrid = CollisionGrid(value, bounds);
+    }
+
+    const CollisionGrid& getCollisionGrid() const { return collisionGrid; }
+
+    // The layout grid stretched over the playable bounds
+    sf::Vector2f getTileSize() const {
+        return {bounds.size.x / RoomTemplate::COLS, bounds.size.y / RoomTemplate::ROWS};
+    }
+
+    sf::Vector2f getTilePosition(int col, int row) const {
+        sf::Vector2f tile = getTileSize();
+        return {bounds.position.x + col * tile.x, bounds.position.y + row * tile.y};
+    }
+
+    const std::vector<SpawnPoint>& getSpawnPlan() const { return spawnPlan; }
+    void setSpawnPlan(std::vector<SpawnPoint> plan) { spawnPlan = std::move(plan); }
+
+    // Entities left behind when the player last exited, restored on return
+    // instead of rolling the spawn plan again
+    bool hasSnapshot() const { return snapshotSaved; }
+    const std::vector<EntitySnapshot>& getSnapshot() const { return snapshot; }
+    void saveSnapshot(std::vector<EntitySnapshot> entities) {
+        snapshot = std::move(entities);
+        snapshotSaved = true;
+    }
     const sf::FloatRect& getBounds() const { return bounds; }
     const std::vector<Door>& getDoors() const { return doors; }
 
@@ -166,4 +228,10 @@ private:
     sf::FloatRect bounds;
     std::vector<Door> doors;
     bool cleared = false;
+    int depth = 0;
+    const RoomTemplate* layout;
+    CollisionGrid collisionGrid;  // Matches layout
+    std::vector<SpawnPoint> spawnPlan;
+    std::vector<EntitySnapshot> snapshot;
+    bool snapshotSaved = false;
 };
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "Room.hpp"
+#include "EntitySnapshot.hpp"
+#include "../ecs/EntityManager.hpp"
+#include "../ecs/EntityFactory.hpp"
+#include <SFML/Graphics.hpp>
+#include <functional>
+#include <utility>
+
+// Builds a room's non-player entities in a second world ahead of entering
+// it, so the transition itself is a swap. Rooms are staged when the player
+// approaches an open door or, at the latest, when the transition fade
+// starts. Only one room is staged at a time.
+class RoomStager {
+public:
+    using FindRoom = std::function<Room*(int)>;
+
+    // Rebuilds the staging world for a room: its snapshot when returning,
+    // its spawn plan on the first visit to an uncleared combat room
+    void stage(const Room& room) {
+        staging.clear();
+
+        if (room.hasSnapshot()) {
+            restoreEntities(staging, room.getSnapshot(), room.getBounds());
+        } else if (room.getType() == RoomType::Combat && !room.isCleared()) {
+            for (const auto& spawn : room.getSpawnPlan()) {
+                EntityFactory::createEnemy(staging, spawn.type, spawn.position, room.getBounds());
+            }
+        }
+
+        stagedRoomId = room.getId();
+    }
+
+    // Stages the room behind the first open door within radius of position,
+    // replacing whatever was staged for another door
+    void stageNearDoor(const Room& current, sf::Vector2f position, float radius, const FindRoom& findRoom) {
+        for (const auto& door : current.getDoors()) {
+            if (door.targetRoomId < 0 || door.locked || door.targetRoomId == stagedRoomId) continue;
+
+            sf::Vector2f center = door.bounds.position + door.bounds.size / 2.f;
+            sf::Vector2f offset = position - center;
+            if (offset.x * offset.x + offset.y * offset.y < radius * radius) {
+                if (Room* target = findRoom(door.targetRoomId)) {
+                    stage(*target);
+                }
+                return;
+            }
+        }
+    }
+
+    // Moves the room's entities into live, staging them first if they
+    // aren't already. Whatever live held is dropped.
+    void swapInto(const Room& room, EntityManager& live) {
+        if (stagedRoomId != room.getId()) {
+            stage(room);
+        }
+        std::swap(live, staging);
+        reset();
+    }
+
+    // Room ids are per floor, so anything staged is stale after a floor change
+    void reset() {
+        staging.clear();
+        stagedRoomId = -1;
+    }
+
+    int getStagedRoomId() const { return stagedRoomId; }
+    EntityManager& getStaging() { return staging; }
+
+private:
+    EntityManager staging;
+    int stagedRoomId = -1;
+};
@@ -0,0 +1,224 @@
+#pragma once
+
+#include "../ecs/EntityFactory.hpp"
+#include "../util/Random.hpp"
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+enum class TileType : std::uint8_t { Floor, Wall, Pit };
+
+struct SpawnWeight {
+    EntityFactory::EnemyType type;
+    std::uint16_t weight;
+};
+
+// A room layout: an obstacle grid covering the playable area plus where and
+// what enemies spawn. Parsed once at startup; rooms only point at one.
+struct RoomTemplate {
+    static constexpr int COLS = 18;
+    static constexpr int ROWS = 13;
+
+    std::string name;
+    std::uint16_t weight = 1;
+    std::array<TileType, COLS * ROWS> tiles{};  // Row-major, all floor by default
+    std::vector<std::uint16_t> spawnCells;      // Tile indices marked 'S'
+    std::vector<SpawnWeight> spawnTable;        // Empty means the default mix
+
+    TileType at(int col, int row) const {
+        if (col < 0 || col >= COLS || row < 0 || row >= ROWS) return TileType::Wall;
+        return tiles[row * COLS + col];
+    }
+
+    EntityFactory::EnemyType pickEnemy(util::Pcg32& rng) const {
+        static const std::vector<SpawnWeight> defaultTable{
+            {EntityFactory::EnemyType::Slime, 2},
+            {EntityFactory::EnemyType::Bat, 1},
+        };
+        const auto& table = spawnTable.empty() ? defaultTable : spawnTable;
+
+        std::uint32_t total = 0;
+        for (const auto& entry : table) total += entry.weight;
+        std::uint32_t roll = rng.nextBounded(total);
+        for (const auto& entry : table) {
+            if (roll < entry.weight) return entry.type;
+            roll -= entry.weight;
+        }
+        return table.back().type;
+    }
+};
+
+// Loads room templates from a text file:
+//
+//   [pillars]
+//   weight 2
+//   spawns slime 3 bat 1
+//   ..................    <- 13 rows of 18 tiles: . floor, # wall,
+//   ...                      O pit, S spawn point (floor)
+//
+// The cells in front of each door must stay floor so rooms can always be
+// crossed. A built-in open template is always available and is what start
+// and exit rooms use.
+class RoomTemplateLibrary {
+public:
+    static RoomTemplateLibrary& instance() {
+        static RoomTemplateLibrary inst;
+        return inst;
+    }
+
+    bool loadFromFile(const std::string& path) {
+        std::ifstream file(path);
+        if (!file) {
+            std::cerr << "[RoomTemplateLibrary] Failed to open templates: " << path << "\n";
+            return false;
+        }
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        return parse(buffer.str());
+    }
+
+    // Replaces every loaded template; broken ones are skipped and reported
+    bool parse(const std::string& text) {
+        templates.resize(1);  // Keep the built-in open room
+
+        std::istringstream stream(text);
+        std::string line;
+        int lineNumber = 0;
+        bool ok = true;
+        RoomTemplate current;
+        int rows = -1;  // -1 until a [name] line
+
+        auto finish = [&]() {
+            if (rows < 0) return;
+            if (rows != RoomTemplate::ROWS) {
+                std::cerr << "[RoomTemplateLibrary] Template " << current.name << " has " << rows
+                          << " rows, expected " << RoomTemplate::ROWS << "\n";
+                ok = false;
+            } else if (!doorsClear(current)) {
+                std::cerr << "[RoomTemplateLibrary] Template " << current.name << " blocks a doorway\n";
+                ok = false;
+            } else {
+                templates.push_back(current);
+            }
+        };
+
+        while (std::getline(stream, line)) {
+            ++lineNumber;
+            if (!line.empty() && line.back() == '\r') line.pop_back();
+            std::istringstream fields(line);
+            std::string word;
+            if (!(fields >> word) || word[0] == '#') continue;
+
+            if (word.front() == '[' && word.back() == ']' && word.size() > 2) {
+                finish();
+                current = RoomTemplate{};
+                current.name = word.substr(1, word.size() - 2);
+                rows = 0;
+                continue;
+            }
+
+            bool valid = rows >= 0;
+            if (valid && word == "weight") {
+                int weight = 0;
+                valid = (fields >> weight) && weight > 0 && weight <= 0xFFFF;
+                current.weight = static_cast<std::uint16_t>(weight);
+            } else if (valid && word == "spawns") {
+                // Name and weight pairs; a name without a weight is an error
+                std::string enemy;
+                while (valid && (fields >> enemy)) {
+                    int weight = 0;
+                    EntityFactory::EnemyType type = EntityFactory::EnemyType::Slime;
+                    valid = (fields >> weight) && parseEnemy(enemy, type) && weight > 0 && weight <= 0xFFFF;
+                    if (valid) current.spawnTable.push_back({type, static_cast<std::uint16_t>(weight)});
+                }
+            } else if (valid) {
+                valid = parseRow(word, rows, current);
+                ++rows;
+            }
+
+            if (!valid) {
+                std::cerr << "[RoomTemplateLibrary] Malformed line " << lineNumber << ": " << line << "\n";
+                ok = false;
+                rows = -1;  // Drop the rest of this template
+            }
+        }
+        finish();
+        return ok;
+    }
+
+    // Start and exit rooms, and the fallback for everything else
+    const RoomTemplate& getOpen() const { return templates[0]; }
+
+    const std::vector<RoomTemplate>& getTemplates() const { return templates; }
+
+    // Weighted pick among all templates for a combat room
+    const RoomTemplate& pick(util::Pcg32& rng) const {
+        std::uint32_t total = 0;
+        for (const auto& t : templates) total += t.weight;
+        std::uint32_t roll = rng.nextBounded(total);
+        for (const auto& t : templates) {
+            if (roll < t.weight) return t;
+            roll -= t.weight;
+        }
+        return templates[0];
+    }
+
+private:
+    RoomTemplateLibrary() {
+        RoomTemplate open;
+        open.name = "open";
+        templates.push_back(open);
+    }
+
+    static bool parseEnemy(const std::string& name, EntityFactory::EnemyType& out) {
+        if (name == "slime") { out = EntityFactory::EnemyType::Slime; return true; }
+        if (name == "bat")   { out = EntityFactory::EnemyType::Bat; return true; }
+        if (name == "archer") { out = EntityFactory::EnemyType::Archer; return true; }
+        return false;
+    }
+
+    static bool parseRow(const std::string& row, int index, RoomTemplate& out) {
+        if (index >= RoomTemplate::ROWS || static_cast<int>(row.size()) != RoomTemplate::COLS) return false;
+
+        for (int col = 0; col < RoomTemplate::COLS; ++col) {
+            int cell = index * RoomTemplate::COLS + col;
+            switch (row[col]) {
+                case '.': out.tiles[cell] = TileType::Floor; break;
+                case '#': out.tiles[cell] = TileType::Wall; break;
+                case 'O': out.tiles[cell] = TileType::Pit; break;
+                case 'S':
+                    out.tiles[cell] = TileType::Floor;
+                    out.spawnCells.push_back(static_cast<std::uint16_t>(cell));
+                    break;
+                default: return false;
+            }
+        }
+        return true;
+    }
+
+    // Doorways and the spots players appear at when walking through them
+    static bool doorsClear(const RoomTemplate& t) {
+        const int midCol = RoomTemplate::COLS / 2;
+        const int midRow = RoomTemplate::ROWS / 2;
+        for (int col = midCol - 1; col <= midCol; ++col) {
+            for (int row : {0, 1, RoomTemplate::ROWS - 2, RoomTemplate::ROWS - 1}) {
+                if (t.at(col, row) != TileType::Floor) return false;
+            }
+        }
+        for (int row = midRow - 1; row <= midRow + 1; ++row) {
+            for (int col : {0, 1, RoomTemplate::COLS - 2, RoomTemplate::COLS - 1}) {
+                if (t.at(col, row) != TileType::Floor) return false;
+            }
+        }
+        return true;
+    }
+
+    std::vector<RoomTemplate> templates;
+
+    RoomTemplateLibrary(const RoomTemplateLibrary&) = delete;
+    RoomTemplateLibrary& operator=(const RoomTemplateLibrary&) = delete;
+};
@@ -1,6 +1,9 @@
 #pragma once
 
+#include "../ecs/Component.hpp"
+#include <cstdint>
 #include <set>
+#include <vector>
 
 struct RunState {
     int playerHealth = 3;
@@ -10,6 +13,13 @@ struct RunState {
     int enemiesKilled = 0;
     int pickupsCollected = 0;
     std::set<int> visitedRooms;
+    std::vector<StatusEffect> playerEffects;  // Boosts still running, with the time they have left
+    std::uint64_t seed = 0;  // Every floor, room and system stream derives from this
+
+    void reset(std::uint64_t runSeed) {
+        reset();
+        seed = runSeed;
+    }
 
     void reset() {
         playerHealth = 3;
@@ -19,6 +29,8 @@ struct RunState {
         enemiesKilled = 0;
         pickupsCollected = 0;
         visitedRooms.clear();
+        playerEffects.clear();
+        seed = 0;
     }
 
     void visitRoom(int roomId) {
@@ -6,7 +6,15 @@ MainMenuState::MainMenuState(sf::Vector2f windowSize)
     : windowSize(windowSize) {}
 
 void MainMenuState::enter() {
+    AssetManager::instance().pinGroup("menu");
     setupUI();
+
+    // Warm the gameplay assets while the player is still on the menu
+    AssetManager::instance().preloadAsync("playing");
+}
+
+void MainMenuState::exit() {
+    AssetManager::instance().unpinGroup("menu");
 }
 
 void MainMenuState::setupUI() {
@@ -15,7 +15,7 @@ public:
     explicit MainMenuState(sf::Vector2f windowSize);
 
     void enter() override;
-    void exit() override {}
+    void exit() override;
 
     void update(float dt) override;
     void render(sf::RenderWindow& window) override;
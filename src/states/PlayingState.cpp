@@ -3,23 +3,63 @@
 #include "VictoryState.hpp"
 #include "PausedState.hpp"
 #include "../core/StateManager.hpp"
+#include "../core/AssetManager.hpp"
 #include "../util/Random.hpp"
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+StringId floorTrack(int floorNumber) {
+    return intern("music_floor" + std::to_string(floorNumber));
+}
+
+// DUNGEON_SEED replays a run; otherwise every run gets a fresh seed
+std::uint64_t chooseRunSeed() {
+    if (const char* fixed = std::getenv("DUNGEON_SEED")) {
+        return std::strtoull(fixed, nullptr, 10);
+    }
+    return util::randomSeed();
+}
+
+// Pure function of its arguments, so it can run on a worker thread
+std::unique_ptr<Floor> generateFloor(int floorNumber, sf::Vector2f roomSize, std::uint64_t runSeed) {
+    std::uint64_t seed = util::deriveSeed(runSeed, static_cast<std::uint64_t>(floorNumber));
+    return std::make_unique<Floor>(floorNumber, roomSize, Floor::defaultRoomCount(floorNumber), seed);
+}
+
+} // namespace
 
 PlayingState::PlayingState(sf::Vector2f windowSize)
-    : windowSize(windowSize) {}
+    : windowSize(windowSize), playerControlSystem(clock), collisionSystem(clock),
+      projectileSystem(clock), pickupSystem(clock) {
+    aiSystem.setLineOfSight(&lineOfSight);
+    projectileSystem.setLineOfSight(&lineOfSight);
+}
 
 void PlayingState::enter() {
-    runState.reset();
+    AssetManager::instance().pinGroup("playing");
+    runState.reset(chooseRunSeed());
+    std::cerr << "[PlayingState] Run seed: " << runState.seed << "\n";
     EventBus::instance().clear();
     setupEventHandlers();
 
-    floor = std::make_unique<Floor>(runState.currentFloor, windowSize);
+    nextFloor = {};  // Waits for a leftover from the previous run
+    floor = generateFloor(runState.currentFloor, windowSize, runState.seed);
+    stager.reset();
     enterRoom();
+    startFloorMusic();
+    pregenerateNextFloor();
 }
 
 void PlayingState::exit() {
     entities.clear();
+    stager.reset();
     EventBus::instance().clear();
+    music.stop();
+    AssetManager::instance().unpinGroup("playing");
 }
 
 void PlayingState::setupEventHandlers() {
@@ -30,9 +70,13 @@ void PlayingState::setupEventHandlers() {
     EventBus::instance().subscribe<EnemyDiedEvent>([this](const EnemyDiedEvent& e) {
         runState.enemiesKilled++;
 
-        // 30% chance to spawn health pickup
-        if (util::randomChance(0.3f)) {
-            EntityFactory::createHealthPickup(entities, {e.x, e.y});
+        // 30% chance to drop a pickup; most drops are health
+        if (lootRng.nextChance(0.3f)) {
+            float roll = lootRng.nextFloat();
+            PickupType type = roll < 0.6f ? PickupType::Health
+                            : roll < 0.8f ? PickupType::SpeedBoost
+                                          : PickupType::DamageUp;
+            EntityFactory::createPickup(entities, type, 1, {e.x, e.y});
         }
     });
 
@@ -58,15 +102,59 @@ void PlayingState::setupEventHandlers() {
             }
         }
     });
+
+    audioSystem.subscribe();
+}
+
+void PlayingState::startFloorMusic() {
+    music.crossfadeTo(floorTrack(runState.currentFloor));
+
+    // Open the next floor's track in the background while this one plays
+    if (runState.currentFloor < MAX_FLOOR) {
+        music.prefetch(floorTrack(runState.currentFloor + 1));
+    }
+}
+
+// Generates the next floor while this one is played, so reaching the exit
+// only swaps it in
+void PlayingState::pregenerateNextFloor() {
+    if (runState.currentFloor >= MAX_FLOOR) return;
+
+    nextFloor = std::async(std::launch::async, generateFloor,
+                           runState.currentFloor + 1, windowSize, runState.seed);
+}
+
+std::unique_ptr<Floor> PlayingState::takeNextFloor() {
+    if (nextFloor.valid()) {
+        return nextFloor.get();  // Already done unless the floor was rushed
+    }
+    return generateFloor(runState.currentFloor, windowSize, runState.seed);
 }
 
 void PlayingState::enterRoom() {
     Room* room = floor->getCurrentRoom();
     if (!room) return;
 
-    entities.clear();
+    // The player is rebuilt below; boosts carry over with the time they
+    // have left
+    if (Entity* previous = getPlayer()) {
+        if (auto* effects = previous->getComponent<StatusEffectComponent>()) {
+            runState.playerEffects = effects->carryOver(clock);
+        }
+    }
+
+    stager.swapInto(*room, entities);
+    physicsSystem.setCollisionGrid(&room->getCollisionGrid());
+    lineOfSight.setGrid(&room->getCollisionGrid());
+    projectileSystem.setRoom(&room->getCollisionGrid(), room->getBounds());
 
-    // Create player
+    // Everything rolled in this room comes from the room's own streams
+    std::uint64_t roomSeed = floor->getRoomSeed(room->getId());
+    lootRng = util::makeRng(roomSeed, util::RngStream::Loot);
+    aiSystem.seed(roomSeed);
+
+    // Create player; done last, so its health is current however long ago
+    // the room was staged
     sf::Vector2f spawnPos = floor->getPlayerSpawnPosition();
     auto& player = EntityFactory::createPlayer(entities, spawnPos, room->getBounds());
 
@@ -76,23 +164,9 @@ void PlayingState::enterRoom() {
         health->current = runState.playerHealth;
         health->max = runState.maxHealth;
     }
-
-    // Spawn enemies for combat rooms
-    if (room->getType() == RoomType::Combat && !room->isCleared()) {
-        int minEnemies = 2 + runState.currentFloor / 2;
-        int maxEnemies = 4 + runState.currentFloor / 2;
-        int count = util::randomInt(minEnemies, maxEnemies);
-
-        const auto& bounds = room->getBounds();
-        for (int i = 0; i < count; ++i) {
-            float x = bounds.position.x + 50.f + util::randomFloat(0.f, bounds.size.x - 100.f);
-            float y = bounds.position.y + 50.f + util::randomFloat(0.f, bounds.size.y - 100.f);
-
-            EntityFactory::EnemyType type = util::randomChance(1.f / 3.f)
-                ? EntityFactory::EnemyType::Bat
-                : EntityFactory::EnemyType::Slime;
-
-            EntityFactory::createEnemy(entities, type, {x, y}, bounds);
+    if (auto* effects = player.getComponent<StatusEffectComponent>()) {
+        for (const auto& effect : runState.playerEffects) {
+            effects->apply(effect, clock);
         }
     }
 
@@ -100,10 +174,13 @@ void PlayingState::enterRoom() {
 }
 
 void PlayingState::update(float dt) {
+    music.update(dt);
+
     if (transitioning) {
         transitionTimer -= dt;
         if (transitionTimer <= 0.f) {
             transitioning = false;
+            floor->getCurrentRoom()->saveSnapshot(captureEntities(entities));
             floor->transitionToRoom(pendingRoomId, pendingDirection);
             enterRoom();
         }
@@ -117,13 +194,20 @@ void PlayingState::update(float dt) {
         playerPos = player->position;
     }
 
+    // Fire expired gameplay timers (attacks, invincibility, status effects)
+    // before systems read them
+    clock.advance(dt);
+    statusEffectSystem.update(entities);
+
     // Update systems
     playerControlSystem.update(entities, dt);
     aiSystem.update(entities, dt, playerPos);
+    steeringSystem.update(entities, dt);
     physicsSystem.update(entities, dt);
+    projectileSystem.update(entities, dt, playerPos);
     collisionSystem.update(entities);
     pickupSystem.update(entities);
-    healthSystem.update(entities, dt);
+    audioSystem.update(playerPos);
 
     entities.cleanup();
 
@@ -150,8 +234,14 @@ void PlayingState::checkRoomTransitions() {
     Room* room = floor->getCurrentRoom();
     if (!room) return;
 
+    // Stage the room behind an open door the player is approaching
+    stager.stageNearDoor(*room, player->position, DOOR_PREFETCH_RADIUS,
+                         [this](int id) { return floor->getRoom(id); });
+
     // Check door transitions
-    Door* door = room->checkDoorCollision(player->position, {32.f, 32.f});
+    auto* playerPhysics = player->getComponent<PhysicsComponent>();
+    sf::Vector2f playerMove = playerPhysics ? playerPhysics->lastMove : sf::Vector2f{0.f, 0.f};
+    Door* door = room->checkDoorCollision(player->position, {32.f, 32.f}, playerMove);
     if (door && door->targetRoomId >= 0) {
         transitionToRoom(door->targetRoomId, door->direction);
         return;
@@ -165,8 +255,11 @@ void PlayingState::checkRoomTransitions() {
         } else {
             // Next floor
             runState.advanceFloor();
-            floor = std::make_unique<Floor>(runState.currentFloor, windowSize);
+            floor = takeNextFloor();
+            stager.reset();  // Ids belong to the old floor
             enterRoom();
+            startFloorMusic();
+            pregenerateNextFloor();
         }
     }
 }
@@ -186,6 +279,12 @@ void PlayingState::transitionToRoom(int targetId, Direction fromDir) {
     transitionTimer = TRANSITION_DURATION;
     pendingRoomId = targetId;
     pendingDirection = opposite;
+
+    // Build the destination during the fade unless it's already staged
+    Room* target = floor->getRoom(targetId);
+    if (target && stager.getStagedRoomId() != targetId) {
+        stager.stage(*target);
+    }
 }
 
 void PlayingState::render(sf::RenderWindow& window) {
@@ -199,6 +298,7 @@ void PlayingState::render(sf::RenderWindow& window) {
 
     // Draw entities
     renderSystem.render(entities, window);
+    projectileSystem.render(window);
 
     // Draw UI
     renderUI(window);
@@ -256,7 +356,7 @@ void PlayingState::renderMinimap(sf::RenderWindow& window) {
 
     // Find bounds
     int minX = 0, maxX = 0, minY = 0, maxY = 0;
-    for (const auto& [id, pos] : positions) {
+    for (const auto& pos : positions) {
         minX = std::min(minX, pos.x);
         maxX = std::max(maxX, pos.x);
         minY = std::min(minY, pos.y);
@@ -264,7 +364,8 @@ void PlayingState::renderMinimap(sf::RenderWindow& window) {
     }
 
     // Draw rooms
-    for (const auto& [id, pos] : positions) {
+    for (int id = 0; id < static_cast<int>(positions.size()); ++id) {
+        const GridPos& pos = positions[id];
         float x = mapX + (pos.x - minX) * (roomW + gap);
         float y = mapY + (pos.y - minY) * (roomH + gap);
 
@@ -7,7 +7,11 @@
 #include "../ecs/Systems.hpp"
 #include "../ecs/EntityFactory.hpp"
 #include "../game/Floor.hpp"
+#include "../game/RoomStager.hpp"
 #include "../game/RunState.hpp"
+#include "../audio/AudioSystem.hpp"
+#include "../audio/MusicPlayer.hpp"
+#include <future>
 #include <memory>
 
 class GameOverState;
@@ -26,7 +30,10 @@ public:
 
 private:
     void setupEventHandlers();
+    void pregenerateNextFloor();
+    std::unique_ptr<Floor> takeNextFloor();
     void enterRoom();
+    void startFloorMusic();
     void transitionToRoom(int targetId, Direction fromDir);
     void checkRoomTransitions();
     void renderUI(sf::RenderWindow& window);
@@ -35,17 +42,29 @@ private:
 
     sf::Vector2f windowSize;
 
+    // Gameplay countdowns (attacks, invincibility, reloads, status effects).
+    // Declared before the entities so it outlives their timers.
+    TimerWheel clock;
+
     EntityManager entities;
+    RoomStager stager;  // Next room's entities, built ahead of entering it
     PhysicsSystem physicsSystem;
     AISystem aiSystem;
+    SteeringSystem steeringSystem;
+    LineOfSight lineOfSight;  // Over the current room's tiles
     PlayerControlSystem playerControlSystem;
     CollisionSystem collisionSystem;
+    ProjectileSystem projectileSystem;
     PickupSystem pickupSystem;
+    StatusEffectSystem statusEffectSystem;
     RenderSystem renderSystem;
-    HealthSystem healthSystem;
+    AudioSystem audioSystem;
+    MusicPlayer music;
 
     std::unique_ptr<Floor> floor;
+    std::future<std::unique_ptr<Floor>> nextFloor;
     RunState runState;
+    util::Pcg32 lootRng;  // Reseeded per room
 
     bool transitioning = false;
     float transitionTimer = 0.f;
@@ -53,5 +72,6 @@ private:
     Direction pendingDirection = Direction::South;
 
     static constexpr float TRANSITION_DURATION = 0.3f;
+    static constexpr float DOOR_PREFETCH_RADIUS = 120.f;
     static constexpr int MAX_FLOOR = 3;
 };
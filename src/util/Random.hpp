@@ -1,31 +1,151 @@
 #pragma once
 
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <random>
 
 namespace util {
 
-// Thread-local random number generator using Mersenne Twister
-inline std::mt19937& getRng() {
-    static thread_local std::mt19937 rng{std::random_device{}()};
+// PCG32 (XSH-RR variant, O'Neill 2014): 16 bytes of state, a multiply and a
+// rotate per number, and statistically far better than its size suggests.
+// Two generators with the same seed but different streams are independent.
+class Pcg32 {
+public:
+    using result_type = std::uint32_t;
+
+    Pcg32() : Pcg32(0) {}
+    explicit Pcg32(std::uint64_t seedValue, std::uint64_t stream = 0) { seed(seedValue, stream); }
+
+    void seed(std::uint64_t seedValue, std::uint64_t stream = 0) {
+        state = 0;
+        increment = (stream << 1u) | 1u;
+        next();
+        state += seedValue;
+        next();
+    }
+
+    std::uint32_t next() {
+        std::uint64_t old = state;
+        state = old * MULTIPLIER + increment;
+        auto xorshifted = static_cast<std::uint32_t>(((old >> 18u) ^ old) >> 27u);
+        auto rot = static_cast<std::uint32_t>(old >> 59u);
+        return (xorshifted >> rot) | (xorshifted << ((32u - rot) & 31u));
+    }
+
+    // Uniform in [0, bound) without modulo bias (Lemire's method)
+    std::uint32_t nextBounded(std::uint32_t bound) {
+        std::uint64_t product = static_cast<std::uint64_t>(next()) * bound;
+        auto low = static_cast<std::uint32_t>(product);
+        if (low < bound) {
+            std::uint32_t threshold = (0u - bound) % bound;
+            while (low < threshold) {
+                product = static_cast<std::uint64_t>(next()) * bound;
+                low = static_cast<std::uint32_t>(product);
+            }
+        }
+        return static_cast<std::uint32_t>(product >> 32);
+    }
+
+    // Uniform in [min, max] (inclusive)
+    int nextInt(int min, int max) {
+        auto span = static_cast<std::uint32_t>(static_cast<std::int64_t>(max) - min + 1);
+        return span == 0 ? static_cast<int>(next()) : min + static_cast<int>(nextBounded(span));
+    }
+
+    // Uniform in [0, 1), using the top 24 bits so every value is exact
+    float nextFloat() {
+        return static_cast<float>(next() >> 8) * (1.f / 16777216.f);
+    }
+
+    // Uniform in [min, max)
+    float nextFloat(float min, float max) {
+        return toFloat(next(), min, max);
+    }
+
+    bool nextChance(float probability) {
+        return nextFloat() < probability;
+    }
+
+    // Bulk generation for batches (spawn tables, particle bursts); output is
+    // the same sequence repeated next() calls would give
+    void fill(std::uint32_t* out, size_t count) {
+        for (size_t i = 0; i < count; ++i) out[i] = next();
+    }
+
+    void fillFloats(float* out, size_t count, float min, float max) {
+        for (size_t i = 0; i < count; ++i) out[i] = toFloat(next(), min, max);
+    }
+
+    // Maps raw output to [min, max). The top values round up to max in
+    // float for most ranges, so the result is clamped just below it.
+    static float toFloat(std::uint32_t bits, float min, float max) {
+        float value = min + static_cast<float>(bits >> 8) * (1.f / 16777216.f) * (max - min);
+        return value < max ? value : std::nextafter(max, min);
+    }
+
+    // UniformRandomBitGenerator, so std distributions and algorithms work too
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+    result_type operator()() { return next(); }
+
+private:
+    static constexpr std::uint64_t MULTIPLIER = 6364136223846793005ull;
+
+    std::uint64_t state = 0;
+    std::uint64_t increment = 1;
+};
+
+// Deterministic stream splitting: a child seed is a pure function of its
+// parent seed and a key, so the run seed alone reproduces every floor, room
+// and system stream no matter in what order they are created.
+inline std::uint64_t deriveSeed(std::uint64_t parent, std::uint64_t key) {
+    // SplitMix64 finalizer
+    std::uint64_t z = parent + 0x9E3779B97F4A7C15ull * (key + 1);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+// Stream ids, so different systems seeded from the same room never share
+// a sequence
+enum class RngStream : std::uint64_t {
+    Layout = 1,
+    Spawns,
+    Loot,
+    AI,
+};
+
+inline Pcg32 makeRng(std::uint64_t seed, RngStream stream) {
+    return Pcg32(seed, static_cast<std::uint64_t>(stream));
+}
+
+// Fresh non-reproducible seed, e.g. for a new run
+inline std::uint64_t randomSeed() {
+    std::random_device device;
+    return (static_cast<std::uint64_t>(device()) << 32) | device();
+}
+
+// Thread-local generator for code that doesn't need reproducibility
+inline Pcg32& getRng() {
+    static thread_local Pcg32 rng{randomSeed()};
     return rng;
 }
 
 // Generate random int in range [min, max] (inclusive)
 inline int randomInt(int min, int max) {
-    std::uniform_int_distribution<int> dist(min, max);
-    return dist(getRng());
+    return getRng().nextInt(min, max);
 }
 
 // Generate random float in range [min, max)
 inline float randomFloat(float min, float max) {
-    std::uniform_real_distribution<float> dist(min, max);
-    return dist(getRng());
+    return getRng().nextFloat(min, max);
 }
 
 // Generate random bool with given probability of true (0.0 to 1.0)
 inline bool randomChance(float probability) {
-    std::uniform_real_distribution<float> dist(0.f, 1.f);
-    return dist(getRng()) < probability;
+    return getRng().nextChance(probability);
 }
 
 } // namespace util
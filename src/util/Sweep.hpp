@@ -0,0 +1,74 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+
+namespace util {
+
+// Continuous (swept) box tests for movers that can cross a whole box in one
+// step, where an overlap test at the end position would miss the contact.
+
+// A step only needs sweeping once it moves further than this fraction of the
+// smaller box on some axis; below that, end-of-step overlap is exact enough
+inline constexpr float SWEEP_THRESHOLD = 0.5f;
+
+inline bool needsSweep(sf::Vector2f delta, sf::Vector2f sizeA, sf::Vector2f sizeB) {
+    return std::abs(delta.x) > SWEEP_THRESHOLD * std::min(sizeA.x, sizeB.x) ||
+           std::abs(delta.y) > SWEEP_THRESHOLD * std::min(sizeA.y, sizeB.y);
+}
+
+// Fraction of delta in [0, 1] at which `moving` first overlaps `target`, or
+// nullopt if it never does during the step. Boxes that only touch edges
+// don't count, matching findIntersection.
+inline std::optional<float> sweepAabb(const sf::FloatRect& moving, sf::Vector2f delta,
+                                      const sf::FloatRect& target) {
+    constexpr float INF = std::numeric_limits<float>::infinity();
+
+    auto axis = [](float minA, float maxA, float minB, float maxB, float d, float& enter, float& exit) {
+        if (d == 0.f) {
+            if (maxA <= minB || minA >= maxB) return false;
+            enter = -INF;
+            exit = INF;
+        } else if (d > 0.f) {
+            enter = (minB - maxA) / d;
+            exit = (maxB - minA) / d;
+        } else {
+            enter = (maxB - minA) / d;
+            exit = (minB - maxA) / d;
+        }
+        return true;
+    };
+
+    float enterX, exitX, enterY, exitY;
+    if (!axis(moving.position.x, moving.position.x + moving.size.x,
+              target.position.x, target.position.x + target.size.x, delta.x, enterX, exitX)) {
+        return std::nullopt;
+    }
+    if (!axis(moving.position.y, moving.position.y + moving.size.y,
+              target.position.y, target.position.y + target.size.y, delta.y, enterY, exitY)) {
+        return std::nullopt;
+    }
+
+    float enter = std::max(enterX, enterY);
+    float exit = std::min(exitX, exitY);
+    if (enter >= exit || exit <= 0.f || enter > 1.f) return std::nullopt;
+    return std::max(enter, 0.f);
+}
+
+// Whether two boxes touched at any point of a step in which they moved by
+// moveA and moveB. a and b are the end-of-step boxes.
+inline bool overlapsDuringStep(const sf::FloatRect& a, sf::Vector2f moveA,
+                               const sf::FloatRect& b, sf::Vector2f moveB) {
+    sf::Vector2f relative = moveA - moveB;
+    if (!needsSweep(relative, a.size, b.size)) {
+        return a.findIntersection(b).has_value();
+    }
+    sf::FloatRect startA(a.position - moveA, a.size);
+    sf::FloatRect startB(b.position - moveB, b.size);
+    return sweepAabb(startA, relative, startB).has_value();
+}
+
+} // namespace util
@@ -0,0 +1,76 @@
+#include <catch2/catch_all.hpp>
+#include "ecs/AIKernel.hpp"
+#include "util/Random.hpp"
+
+namespace {
+
+AIBatch randomBatch(size_t count, std::uint64_t seed) {
+    util::Pcg32 rng(seed);
+    AIBatch batch;
+    for (size_t i = 0; i < count; ++i) {
+        batch.push({rng.nextFloat(-400.f, 400.f), rng.nextFloat(-400.f, 400.f)},
+                   rng.nextFloat(50.f, 200.f), rng.nextFloat(200.f, 300.f), rng.nextFloat(40.f, 120.f),
+                   rng.nextChance(0.5f), {rng.nextFloat(-50.f, 50.f), rng.nextFloat(-50.f, 50.f)});
+    }
+    return batch;
+}
+
+} // namespace
+
+// ============================================================================
+// AIKernel Tests
+// ============================================================================
+
+TEST_CASE("AIKernel starts chasing inside the detection radius", "[aikernel]") {
+    AIBatch batch;
+    batch.push({100.f, 0.f}, 150.f, 200.f, 80.f, false, {0.f, 0.f});
+    runAIKernelScalar(batch, {0.f, 0.f});
+
+    REQUIRE(batch.chasing[0] == 1);
+    REQUIRE(batch.distance2[0] == Catch::Approx(10000.f));
+    REQUIRE(batch.velX[0] == Catch::Approx(-80.f));
+    REQUIRE(batch.velY[0] == Catch::Approx(0.f));
+}
+
+TEST_CASE("AIKernel keeps chasing until past the lose radius", "[aikernel]") {
+    AIBatch batch;
+    batch.push({0.f, 180.f}, 150.f, 200.f, 80.f, true, {0.f, 0.f});   // Between the radii
+    batch.push({0.f, 180.f}, 150.f, 200.f, 80.f, false, {5.f, 5.f});  // Between, not chasing
+    batch.push({0.f, 250.f}, 150.f, 200.f, 80.f, true, {5.f, 5.f});   // Past the lose radius
+    runAIKernelScalar(batch, {0.f, 0.f});
+
+    REQUIRE(batch.chasing[0] == 1);
+    REQUIRE(batch.velY[0] == Catch::Approx(-80.f));
+    REQUIRE(batch.chasing[1] == 0);
+    REQUIRE(batch.velX[1] == 5.f);  // Untouched: wander decides it
+    REQUIRE(batch.chasing[2] == 0);
+    REQUIRE(batch.velY[2] == 5.f);
+}
+
+TEST_CASE("AIKernel leaves velocity alone when on top of the player", "[aikernel]") {
+    AIBatch batch;
+    batch.push({10.f, 10.f}, 150.f, 200.f, 80.f, true, {3.f, 4.f});
+    runAIKernelScalar(batch, {10.f, 10.f});
+
+    REQUIRE(batch.chasing[0] == 1);
+    REQUIRE(batch.velX[0] == 3.f);
+    REQUIRE(batch.velY[0] == 4.f);
+}
+
+TEST_CASE("AIKernel dispatch matches the scalar kernel", "[aikernel]") {
+    // Sizes that are not a multiple of 8 also exercise the scalar tail
+    for (size_t count : {1u, 8u, 37u, 1000u}) {
+        AIBatch scalar = randomBatch(count, count);
+        AIBatch dispatched = scalar;
+
+        runAIKernelScalar(scalar, {12.5f, -40.f});
+        runAIKernel(dispatched, {12.5f, -40.f});
+
+        for (size_t i = 0; i < count; ++i) {
+            REQUIRE(dispatched.chasing[i] == scalar.chasing[i]);
+            REQUIRE(dispatched.distance2[i] == Catch::Approx(scalar.distance2[i]));
+            REQUIRE(dispatched.velX[i] == Catch::Approx(scalar.velX[i]).margin(1e-4));
+            REQUIRE(dispatched.velY[i] == Catch::Approx(scalar.velY[i]).margin(1e-4));
+        }
+    }
+}
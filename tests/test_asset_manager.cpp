@@ -0,0 +1,36 @@
+#include <catch2/catch_all.hpp>
+#include "core/AssetManager.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+sf::SoundBuffer makeBuffer(std::vector<std::int16_t> samples) {
+    sf::SoundBuffer buffer;
+    REQUIRE(buffer.loadFromSamples(samples.data(), samples.size(), 1, 22050, {sf::SoundChannel::Mono}));
+    return buffer;
+}
+
+} // namespace
+
+// ============================================================================
+// Sound Reload Tests
+// ============================================================================
+
+TEST_CASE("reloadSoundBuffer keeps a playing voice bound to the buffer", "[assets][reload]") {
+    sf::SoundBuffer live = makeBuffer({1, 2, 3, 4});
+    sf::Sound voice(live);
+    voice.play();
+
+    sf::SoundBuffer fresh = makeBuffer({5, 6, 7, 8, 9, 10});
+    REQUIRE(reloadSoundBuffer(live, fresh));
+
+    REQUIRE(&voice.getBuffer() == &live);
+    REQUIRE(live.getSampleCount() == 6);
+    REQUIRE(live.getSamples()[0] == 5);
+    REQUIRE(live.getSampleRate() == 22050);
+
+    // The buffer keeps serving new voices too
+    sf::Sound next(live);
+    REQUIRE(&next.getBuffer() == &live);
+}
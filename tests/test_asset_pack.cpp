@@ -0,0 +1,298 @@
+#include <catch2/catch_all.hpp>
+#include "core/AssetPack.hpp"
+#include "core/AssetManifest.hpp"
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace {
+
+std::string tempPackPath(const std::string& name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+// Rewrites every used table entry of a pack file in place
+template<typename Patch>
+void patchEntries(const std::string& path, Patch patch) {
+    std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+    AssetPack::Header header{};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    for (std::uint32_t i = 0; i < header.tableSize; ++i) {
+        std::streamoff at = static_cast<std::streamoff>(header.tableOffset + i * sizeof(AssetPack::Entry));
+        AssetPack::Entry entry{};
+        file.seekg(at);
+        file.read(reinterpret_cast<char*>(&entry), sizeof(entry));
+        if (entry.hash == 0) continue;
+        patch(entry);
+        file.seekp(at);
+        file.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+    }
+}
+
+} // namespace
+
+// ============================================================================
+// AssetPack Tests
+// ============================================================================
+
+TEST_CASE("AssetPack round-trips a texture", "[assetpack]") {
+    std::string path = tempPackPath("dc_test_texture.pak");
+
+    std::vector<std::uint8_t> pixels(2 * 3 * 4);
+    for (size_t i = 0; i < pixels.size(); ++i) pixels[i] = static_cast<std::uint8_t>(i);
+
+    AssetPackWriter writer;
+    writer.addTexture("player", 2, 3, pixels.data());
+    REQUIRE(writer.write(path));
+
+    AssetPack pack;
+    REQUIRE(pack.open(path));
+    REQUIRE(pack.count() == 1);
+
+    const auto* entry = pack.find("player");
+    REQUIRE(entry != nullptr);
+    REQUIRE(entry->type == AssetPack::EntryType::Texture);
+    REQUIRE(entry->width == 2);
+    REQUIRE(entry->height == 3);
+    REQUIRE(entry->size == pixels.size());
+    REQUIRE(std::equal(pixels.begin(), pixels.end(), pack.data(*entry)));
+    REQUIRE(reinterpret_cast<std::uintptr_t>(pack.data(*entry)) % 16 == 0);
+
+    pack.close();
+    std::remove(path.c_str());
+}
+
+TEST_CASE("AssetPack round-trips sound samples", "[assetpack]") {
+    std::string path = tempPackPath("dc_test_sound.pak");
+
+    std::vector<std::int16_t> samples{0, 100, -100, 32767, -32768, 7};
+
+    AssetPackWriter writer;
+    writer.addSound("hit", samples.data(), samples.size(), 2, 22050, {2, 3});
+    REQUIRE(writer.write(path));
+
+    AssetPack pack;
+    REQUIRE(pack.open(path));
+
+    const auto* entry = pack.find("hit");
+    REQUIRE(entry != nullptr);
+    REQUIRE(entry->type == AssetPack::EntryType::Sound);
+    REQUIRE(entry->width == 2);       // Channels
+    REQUIRE(entry->height == 22050);  // Sample rate
+    REQUIRE(entry->channelMap[0] == 2);
+    REQUIRE(entry->channelMap[1] == 3);
+    REQUIRE(entry->size == samples.size() * sizeof(std::int16_t));
+
+    const auto* stored = reinterpret_cast<const std::int16_t*>(pack.data(*entry));
+    REQUIRE(std::equal(samples.begin(), samples.end(), stored));
+
+    pack.close();
+    std::remove(path.c_str());
+}
+
+TEST_CASE("AssetPack finds many entries by id", "[assetpack]") {
+    std::string path = tempPackPath("dc_test_many.pak");
+
+    AssetPackWriter writer;
+    for (int i = 0; i < 200; ++i) {
+        std::string id = "asset_" + std::to_string(i);
+        std::uint8_t byte = static_cast<std::uint8_t>(i);
+        writer.addFont(id, &byte, 1);
+    }
+    REQUIRE(writer.write(path));
+
+    AssetPack pack;
+    REQUIRE(pack.open(path));
+    REQUIRE(pack.count() == 200);
+
+    for (int i = 0; i < 200; ++i) {
+        std::string id = "asset_" + std::to_string(i);
+        const auto* entry = pack.find(id);
+        REQUIRE(entry != nullptr);
+        REQUIRE(pack.idOf(*entry) == id);
+        REQUIRE(*pack.data(*entry) == static_cast<std::uint8_t>(i));
+    }
+    REQUIRE(pack.find("missing") == nullptr);
+
+    pack.close();
+    std::remove(path.c_str());
+}
+
+TEST_CASE("AssetPack stores music as raw file bytes", "[assetpack]") {
+    std::string path = tempPackPath("dc_test_music.pak");
+
+    std::vector<std::uint8_t> ogg{'O', 'g', 'g', 'S', 0, 2, 0, 0};
+    AssetPackWriter writer;
+    writer.addMusic("music_floor1", ogg.data(), ogg.size());
+    REQUIRE(writer.write(path));
+
+    AssetPack pack;
+    REQUIRE(pack.open(path));
+
+    const auto* entry = pack.find("music_floor1");
+    REQUIRE(entry != nullptr);
+    REQUIRE(entry->type == AssetPack::EntryType::Music);
+    REQUIRE(entry->size == ogg.size());
+    REQUIRE(std::equal(ogg.begin(), ogg.end(), pack.data(*entry)));
+
+    pack.close();
+    std::remove(path.c_str());
+}
+
+TEST_CASE("AssetPack re-adding an id replaces it", "[assetpack]") {
+    std::string path = tempPackPath("dc_test_replace.pak");
+
+    std::uint8_t first = 1, second = 2;
+    AssetPackWriter writer;
+    writer.addFont("pixel", &first, 1);
+    writer.addFont("pixel", &second, 1);
+    REQUIRE(writer.count() == 1);
+    REQUIRE(writer.write(path));
+
+    AssetPack pack;
+    REQUIRE(pack.open(path));
+    REQUIRE(*pack.data(*pack.find("pixel")) == 2);
+
+    pack.close();
+    std::remove(path.c_str());
+}
+
+TEST_CASE("AssetPack rejects files that are not packs", "[assetpack]") {
+    std::string path = tempPackPath("dc_test_garbage.pak");
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << "definitely not a pack file, just some text padding it out";
+    }
+
+    AssetPack pack;
+    REQUIRE_FALSE(pack.open(path));
+    REQUIRE_FALSE(pack.isOpen());
+    REQUIRE_FALSE(pack.open(tempPackPath("dc_test_does_not_exist.pak")));
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("AssetPack rejects textures whose size does not match", "[assetpack]") {
+    std::string path = tempPackPath("dc_test_bad_texture.pak");
+
+    std::vector<std::uint8_t> pixels(4 * 4 * 4, 0xFF);
+    AssetPackWriter writer;
+    writer.addTexture("player", 4, 4, pixels.data());
+    REQUIRE(writer.write(path));
+
+    // Claim a larger texture than the payload holds
+    patchEntries(path, [](AssetPack::Entry& entry) { entry.height = 4096; });
+
+    AssetPack pack;
+    REQUIRE_FALSE(pack.open(path));
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("AssetPack rejects malformed sound entries", "[assetpack]") {
+    std::string path = tempPackPath("dc_test_bad_sound.pak");
+    std::vector<std::int16_t> samples{1, 2, 3, 4};
+
+    auto rejects = [&](void (*patch)(AssetPack::Entry&)) {
+        AssetPackWriter writer;
+        writer.addSound("hit", samples.data(), samples.size(), 2, 22050, {2, 3});
+        REQUIRE(writer.write(path));
+        patchEntries(path, patch);
+
+        AssetPack pack;
+        bool opened = pack.open(path);
+        pack.close();
+        return !opened;
+    };
+
+    REQUIRE_FALSE(rejects([](AssetPack::Entry&) {}));
+    REQUIRE(rejects([](AssetPack::Entry& e) { e.size -= 1; }));    // Half a sample
+    REQUIRE(rejects([](AssetPack::Entry& e) { e.offset += 1; e.size -= 2; }));  // Misaligned
+    REQUIRE(rejects([](AssetPack::Entry& e) { e.width = 0; }));
+    REQUIRE(rejects([](AssetPack::Entry& e) { e.width = 9; }));   // More channels than the map holds
+    REQUIRE(rejects([](AssetPack::Entry& e) { e.height = 0; }));  // No sample rate
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("AssetPack rejects a hash table with no empty slot", "[assetpack]") {
+    std::string path = tempPackPath("dc_test_full_table.pak");
+    {
+        // The header claims no entries, but its only slot is taken
+        AssetPack::Header header{};
+        std::memcpy(header.magic, AssetPack::MAGIC, sizeof(header.magic));
+        header.version = AssetPack::VERSION;
+        header.entryCount = 0;
+        header.tableSize = 1;
+        header.tableOffset = sizeof(AssetPack::Header);
+
+        AssetPack::Entry entry{};
+        entry.hash = 42;
+        entry.type = AssetPack::EntryType::Font;
+
+        std::ofstream file(path, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+    }
+
+    AssetPack pack;
+    REQUIRE_FALSE(pack.open(path));
+
+    std::remove(path.c_str());
+}
+
+// ============================================================================
+// AssetManifest Tests
+// ============================================================================
+
+TEST_CASE("AssetManifest parses entries and skips comments", "[assetpack][manifest]") {
+    AssetManifest manifest;
+    bool ok = manifest.parse(
+        "# comment\n"
+        "\n"
+        "font pixel assets/fonts/pixel.ttf\n"
+        "texture player assets/textures/player.png\n"
+        "sound hit assets/sounds/sfx/hit.wav\n"
+        "music theme assets/sounds/music/theme.ogg\n");
+
+    REQUIRE(ok);
+    const auto& entries = manifest.getEntries();
+    REQUIRE(entries.size() == 4);
+    REQUIRE(entries[0].kind == AssetKind::Font);
+    REQUIRE(entries[0].id == "pixel");
+    REQUIRE(entries[1].kind == AssetKind::Texture);
+    REQUIRE(entries[1].path == "assets/textures/player.png");
+    REQUIRE(entries[2].kind == AssetKind::Sound);
+    REQUIRE(entries[3].kind == AssetKind::Music);
+}
+
+TEST_CASE("AssetManifest reports malformed lines", "[assetpack][manifest]") {
+    AssetManifest manifest;
+    bool ok = manifest.parse(
+        "font pixel assets/fonts/pixel.ttf\n"
+        "model tree assets/tree.obj\n"
+        "texture missing_path\n");
+
+    REQUIRE_FALSE(ok);
+    REQUIRE(manifest.getEntries().size() == 1);
+}
+
+TEST_CASE("AssetManifest assigns entries to preload groups", "[assetpack][manifest]") {
+    AssetManifest manifest;
+    bool ok = manifest.parse(
+        "font debug assets/fonts/debug.ttf\n"
+        "[menu]\n"
+        "font pixel assets/fonts/pixel.ttf\n"
+        "[playing]\n"
+        "texture player assets/textures/player.png\n"
+        "sound hit assets/sounds/sfx/hit.wav\n");
+
+    REQUIRE(ok);
+    const auto& entries = manifest.getEntries();
+    REQUIRE(entries.size() == 4);
+    REQUIRE(entries[0].group.empty());
+    REQUIRE(entries[1].group == "menu");
+    REQUIRE(entries[2].group == "playing");
+    REQUIRE(entries[3].group == "playing");
+}
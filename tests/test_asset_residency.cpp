@@ -0,0 +1,54 @@
+#include <catch2/catch_all.hpp>
+#include "core/AssetResidency.hpp"
+
+TEST_CASE("selectEvictions does nothing under budget", "[residency]") {
+    std::vector<EvictionCandidate> candidates{
+        {1, 100, 0, 1},
+        {2, 100, 0, 2},
+    };
+
+    REQUIRE(selectEvictions(candidates, 200, 300, 10).empty());
+    REQUIRE(selectEvictions(candidates, 200, 0, 10).empty());  // Unlimited
+}
+
+TEST_CASE("selectEvictions drops least recently used first", "[residency]") {
+    std::vector<EvictionCandidate> candidates{
+        {5, 100, 0, 1},
+        {2, 100, 0, 2},
+        {7, 100, 1, 3},
+        {3, 100, 0, 4},
+    };
+
+    auto victims = selectEvictions(candidates, 400, 250, 10);
+
+    REQUIRE(victims.size() == 2);
+    REQUIRE(victims[0].id == 2);
+    REQUIRE(victims[1].id == 4);
+}
+
+TEST_CASE("selectEvictions keeps assets used in the previous frame", "[residency]") {
+    std::vector<EvictionCandidate> candidates{
+        {9, 500, 0, 1},
+        {10, 500, 0, 2},
+        {4, 100, 0, 3},
+    };
+
+    // Frame 10 is current, so assets touched in frames 9 and 10 are in use
+    auto victims = selectEvictions(candidates, 1100, 100, 10);
+
+    REQUIRE(victims.size() == 1);
+    REQUIRE(victims[0].id == 3);
+}
+
+TEST_CASE("selectEvictions stops once within budget", "[residency]") {
+    std::vector<EvictionCandidate> candidates{
+        {1, 300, 0, 1},
+        {2, 50, 0, 2},
+        {3, 50, 0, 3},
+    };
+
+    auto victims = selectEvictions(candidates, 400, 200, 10);
+
+    REQUIRE(victims.size() == 1);
+    REQUIRE(victims[0].id == 1);
+}
@@ -0,0 +1,85 @@
+#include <catch2/catch_all.hpp>
+#include "core/AssetWatcher.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+
+#if defined(__linux__)
+
+namespace {
+
+struct ChangeLog {
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::vector<std::string> paths;
+
+    bool waitFor(size_t count) {
+        std::unique_lock<std::mutex> lock(mutex);
+        return changed.wait_for(lock, std::chrono::seconds(2), [&]() { return paths.size() >= count; });
+    }
+};
+
+void writeFile(const std::filesystem::path& path, const std::string& contents) {
+    std::ofstream file(path);
+    file << contents;
+}
+
+} // namespace
+
+TEST_CASE("AssetWatcher reports writes to watched files", "[assetwatcher]") {
+    auto dir = std::filesystem::temp_directory_path() / "dc_test_watcher";
+    std::filesystem::create_directories(dir);
+    auto watched = dir / "player.png";
+    auto other = dir / "notes.txt";
+    writeFile(watched, "v1");
+
+    ChangeLog log;
+    AssetWatcher watcher;
+    REQUIRE(watcher.start({watched.string()}, [&log](const std::string& path) {
+        std::lock_guard<std::mutex> lock(log.mutex);
+        log.paths.push_back(path);
+        log.changed.notify_all();
+    }));
+    REQUIRE(watcher.isRunning());
+
+    writeFile(other, "ignored");
+    writeFile(watched, "v2");
+
+    REQUIRE(log.waitFor(1));
+    watcher.stop();
+
+    REQUIRE_FALSE(watcher.isRunning());
+    REQUIRE(log.paths.size() == 1);
+    REQUIRE(log.paths[0] == watched.string());
+
+    std::filesystem::remove_all(dir);
+}
+
+TEST_CASE("AssetWatcher picks up files replaced by rename", "[assetwatcher]") {
+    auto dir = std::filesystem::temp_directory_path() / "dc_test_watcher_rename";
+    std::filesystem::create_directories(dir);
+    auto watched = dir / "hit.wav";
+    auto temp = dir / "hit.wav.tmp";
+    writeFile(watched, "v1");
+
+    ChangeLog log;
+    AssetWatcher watcher;
+    REQUIRE(watcher.start({watched.string()}, [&log](const std::string& path) {
+        std::lock_guard<std::mutex> lock(log.mutex);
+        log.paths.push_back(path);
+        log.changed.notify_all();
+    }));
+
+    writeFile(temp, "v2");
+    std::filesystem::rename(temp, watched);
+
+    REQUIRE(log.waitFor(1));
+    watcher.stop();
+    REQUIRE(log.paths[0] == watched.string());
+
+    std::filesystem::remove_all(dir);
+}
+
+#endif
@@ -0,0 +1,172 @@
+#include <catch2/catch_all.hpp>
+#include "ecs/BehaviorTree.hpp"
+#include "ecs/EntityFactory.hpp"
+#include "ecs/Systems.hpp"
+
+namespace {
+
+// Restores the default-only library, since it is process-wide
+struct LibraryGuard {
+    ~LibraryGuard() { BehaviorTreeLibrary::instance().parse(""); }
+};
+
+// Runs `tree` once for an agent at `position`, with the kernel's perception
+struct Agent {
+    AIComponent ai;
+    PhysicsComponent physics;
+    AIBatch batch;
+    util::Pcg32 rng{1};
+
+    bool run(const BehaviorTree& tree, sf::Vector2f position, sf::Vector2f player) {
+        batch.clear();
+        batch.push(position, ai.detectionRadius, ai.loseRadius, ai.chaseSpeed, ai.isChasing, physics.velocity);
+        runAIKernelScalar(batch, player);
+        ai.isChasing = batch.chasing[0] != 0;
+        BTContext context{ai, physics, batch, 0, player, rng};
+        return runBehavior(tree, context);
+    }
+};
+
+} // namespace
+
+// ============================================================================
+// BehaviorTreeLibrary Tests
+// ============================================================================
+
+TEST_CASE("BehaviorTreeLibrary compiles trees to preorder arrays", "[behaviortree]") {
+    LibraryGuard guard;
+    REQUIRE(BehaviorTreeLibrary::instance().parse(
+        "[guard]\n"
+        "selector\n"
+        "  sequence\n"
+        "    player_within 100\n"
+        "    chase\n"
+        "  stop\n"));
+
+    std::uint16_t id = BehaviorTreeLibrary::instance().find("guard");
+    REQUIRE(id == 1);
+    const auto& nodes = BehaviorTreeLibrary::instance().get(id).nodes;
+    REQUIRE(nodes.size() == 5);
+    REQUIRE(nodes[0].op == BTOp::Selector);
+    REQUIRE(nodes[0].end == 5);
+    REQUIRE(nodes[1].op == BTOp::Sequence);
+    REQUIRE(nodes[1].end == 4);
+    REQUIRE(nodes[2].op == BTOp::PlayerWithin);
+    REQUIRE(nodes[2].param == 100.f);
+    REQUIRE(nodes[4].op == BTOp::Stop);
+}
+
+TEST_CASE("BehaviorTreeLibrary assigns blackboard slots by name", "[behaviortree]") {
+    LibraryGuard guard;
+    REQUIRE(BehaviorTreeLibrary::instance().parse(
+        "[timers]\n"
+        "sequence\n"
+        "  timer_done a\n"
+        "  set_timer b 2\n"
+        "  set_timer a\n"));
+
+    const auto& tree = BehaviorTreeLibrary::instance().get(BehaviorTreeLibrary::instance().find("timers"));
+    REQUIRE(tree.slots == std::vector<std::string>{"a", "b"});
+    REQUIRE(tree.nodes[1].slot == 0);
+    REQUIRE(tree.nodes[2].slot == 1);
+    REQUIRE(tree.nodes[3].slot == 0);
+    REQUIRE(tree.nodes[3].param < 0.f);  // Falls back to directionChangeInterval
+}
+
+TEST_CASE("BehaviorTreeLibrary skips malformed trees", "[behaviortree]") {
+    LibraryGuard guard;
+    bool ok = BehaviorTreeLibrary::instance().parse(
+        "[unknown]\n"
+        "dance\n"
+        "[leaf_parent]\n"
+        "chase\n"
+        "  stop\n"
+        "[two_roots]\n"
+        "chase\n"
+        "stop\n"
+        "[empty_sequence]\n"
+        "sequence\n"
+        "[bad_chance]\n"
+        "chance 2\n"
+        "[fine]\n"
+        "stop\n");
+
+    REQUIRE_FALSE(ok);
+    REQUIRE(BehaviorTreeLibrary::instance().size() == 2);
+    REQUIRE(BehaviorTreeLibrary::instance().find("fine") == 1);
+    REQUIRE(BehaviorTreeLibrary::instance().find("unknown") == 0);  // Falls back to the default
+}
+
+// ============================================================================
+// Behavior Evaluation Tests
+// ============================================================================
+
+TEST_CASE("Default tree chases a nearby player", "[behaviortree]") {
+    Agent agent;
+    const auto& tree = BehaviorTreeLibrary::instance().get(0);
+
+    REQUIRE(agent.run(tree, {100.f, 0.f}, {0.f, 0.f}));
+    REQUIRE(agent.ai.isChasing);
+    REQUIRE(agent.physics.velocity.x == Catch::Approx(-agent.ai.chaseSpeed));
+}
+
+TEST_CASE("Default tree wanders on its timer", "[behaviortree]") {
+    Agent agent;
+    agent.ai.directionChangeInterval = 0.5f;
+    const auto& tree = BehaviorTreeLibrary::instance().get(0);
+
+    REQUIRE(agent.run(tree, {1000.f, 0.f}, {0.f, 0.f}));
+    float speed = std::sqrt(agent.physics.velocity.x * agent.physics.velocity.x +
+                            agent.physics.velocity.y * agent.physics.velocity.y);
+    REQUIRE(speed == Catch::Approx(agent.ai.wanderSpeed));
+    REQUIRE(agent.ai.blackboard[0] >= 0.5f);
+    REQUIRE(agent.ai.blackboard[0] < 1.f);
+
+    // Timer still running: keeps its heading
+    sf::Vector2f heading = agent.physics.velocity;
+    REQUIRE(agent.run(tree, {1000.f, 0.f}, {0.f, 0.f}));
+    REQUIRE(agent.physics.velocity == heading);
+}
+
+TEST_CASE("Trees can use flee, invert and player_within", "[behaviortree]") {
+    LibraryGuard guard;
+    REQUIRE(BehaviorTreeLibrary::instance().parse(
+        "[coward]\n"
+        "selector\n"
+        "  sequence\n"
+        "    invert\n"
+        "      player_within 300\n"
+        "    stop\n"
+        "  flee\n"));
+    const auto& tree = BehaviorTreeLibrary::instance().get(BehaviorTreeLibrary::instance().find("coward"));
+
+    Agent agent;
+    REQUIRE(agent.run(tree, {250.f, 0.f}, {0.f, 0.f}));
+    REQUIRE(agent.physics.velocity.x == Catch::Approx(agent.ai.chaseSpeed));  // Away from the player
+
+    REQUIRE(agent.run(tree, {500.f, 0.f}, {0.f, 0.f}));
+    REQUIRE(agent.physics.velocity == sf::Vector2f{0.f, 0.f});
+}
+
+TEST_CASE("AISystem runs each agent's own tree", "[behaviortree][system]") {
+    LibraryGuard guard;
+    REQUIRE(BehaviorTreeLibrary::instance().parse(
+        "[statue]\n"
+        "stop\n"));
+
+    EntityManager manager;
+    AISystem aiSystem;
+
+    auto& statue = manager.createEntity();
+    statue.addComponent<AIComponent>().tree = BehaviorTreeLibrary::instance().find("statue");
+    statue.addComponent<PhysicsComponent>().velocity = {5.f, 5.f};
+
+    auto& walker = manager.createEntity();
+    walker.position = {50.f, 0.f};
+    walker.addComponent<AIComponent>();
+    walker.addComponent<PhysicsComponent>();
+
+    aiSystem.update(manager, 0.016f, {100.f, 0.f});
+    REQUIRE(statue.getComponent<PhysicsComponent>()->velocity == sf::Vector2f{0.f, 0.f});
+    REQUIRE(walker.getComponent<PhysicsComponent>()->velocity.x > 0.f);  // Default tree chases
+}
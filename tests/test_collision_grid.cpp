@@ -0,0 +1,104 @@
+#include <catch2/catch_all.hpp>
+#include "game/CollisionGrid.hpp"
+#include "ecs/Systems.hpp"
+
+namespace {
+
+// 10x10 tiles with the grid's origin at (0, 0)
+const sf::FloatRect AREA({0.f, 0.f}, {RoomTemplate::COLS * 10.f, RoomTemplate::ROWS * 10.f});
+
+RoomTemplate makeLayout(std::initializer_list<std::pair<int, int>> cells, TileType type) {
+    RoomTemplate layout;
+    layout.tiles.fill(TileType::Floor);
+    for (auto [col, row] : cells) {
+        layout.tiles[row * RoomTemplate::COLS + col] = type;
+    }
+    return layout;
+}
+
+} // namespace
+
+// ============================================================================
+// CollisionGrid Tests
+// ============================================================================
+
+TEST_CASE("CollisionGrid stops a box flush against a wall", "[collision]") {
+    CollisionGrid grid(makeLayout({{5, 2}}, TileType::Wall), AREA);
+
+    // Box spans x 30..40, wall tile spans x 50..60
+    auto result = grid.move({35.f, 25.f}, {5.f, 5.f}, {20.f, 0.f}, CollisionGrid::BLOCKS_WALKERS);
+    REQUIRE(result.hitX);
+    REQUIRE_FALSE(result.hitY);
+    REQUIRE(result.position.x == Catch::Approx(45.f));
+    REQUIRE(result.position.y == Catch::Approx(25.f));
+}
+
+TEST_CASE("CollisionGrid slides along a wall on the free axis", "[collision]") {
+    CollisionGrid grid(makeLayout({{5, 2}, {5, 3}, {5, 4}}, TileType::Wall), AREA);
+
+    auto result = grid.move({45.f, 25.f}, {5.f, 5.f}, {3.f, 12.f}, CollisionGrid::BLOCKS_WALKERS);
+    REQUIRE(result.hitX);
+    REQUIRE_FALSE(result.hitY);
+    REQUIRE(result.position.x == Catch::Approx(45.f));
+    REQUIRE(result.position.y == Catch::Approx(37.f));
+}
+
+TEST_CASE("CollisionGrid pits block walkers but not flyers", "[collision]") {
+    CollisionGrid grid(makeLayout({{2, 5}}, TileType::Pit), AREA);
+
+    REQUIRE(grid.isBlocked(2, 5, CollisionGrid::BLOCKS_WALKERS));
+    REQUIRE_FALSE(grid.isBlocked(2, 5, CollisionGrid::BLOCKS_FLYERS));
+
+    auto walker = grid.move({25.f, 35.f}, {5.f, 5.f}, {0.f, 30.f}, CollisionGrid::BLOCKS_WALKERS);
+    REQUIRE(walker.hitY);
+    REQUIRE(walker.position.y == Catch::Approx(45.f));
+
+    auto flyer = grid.move({25.f, 35.f}, {5.f, 5.f}, {0.f, 30.f}, CollisionGrid::BLOCKS_FLYERS);
+    REQUIRE_FALSE(flyer.hitY);
+    REQUIRE(flyer.position.y == Catch::Approx(65.f));
+}
+
+TEST_CASE("CollisionGrid does not tunnel through thin walls", "[collision]") {
+    CollisionGrid grid(makeLayout({{8, 0}, {8, 1}, {8, 2}}, TileType::Wall), AREA);
+
+    // One step far larger than the wall is thick
+    auto result = grid.move({15.f, 15.f}, {4.f, 4.f}, {150.f, 0.f}, CollisionGrid::BLOCKS_WALKERS);
+    REQUIRE(result.hitX);
+    REQUIRE(result.position.x == Catch::Approx(76.f));
+}
+
+TEST_CASE("CollisionGrid lets a box touching a wall move away from it", "[collision]") {
+    CollisionGrid grid(makeLayout({{5, 2}}, TileType::Wall), AREA);
+
+    auto result = grid.move({45.f, 25.f}, {5.f, 5.f}, {-10.f, 0.f}, CollisionGrid::BLOCKS_WALKERS);
+    REQUIRE_FALSE(result.hitX);
+    REQUIRE(result.position.x == Catch::Approx(35.f));
+    REQUIRE_FALSE(grid.overlaps(result.position, {5.f, 5.f}, CollisionGrid::BLOCKS_WALKERS));
+}
+
+TEST_CASE("CollisionGrid without obstacles passes movement through", "[collision]") {
+    CollisionGrid grid;
+    auto result = grid.move({10.f, 10.f}, {5.f, 5.f}, {500.f, -3.f}, CollisionGrid::BLOCKS_WALKERS);
+    REQUIRE_FALSE(result.hitX);
+    REQUIRE_FALSE(result.hitY);
+    REQUIRE(result.position.x == Catch::Approx(510.f));
+    REQUIRE(result.position.y == Catch::Approx(7.f));
+}
+
+TEST_CASE("PhysicsSystem stops entities at obstacles", "[collision][systems]") {
+    CollisionGrid grid(makeLayout({{5, 2}}, TileType::Wall), AREA);
+    PhysicsSystem physicsSystem;
+    physicsSystem.setCollisionGrid(&grid);
+
+    EntityManager entities;
+    Entity& entity = entities.createEntity();
+    entity.position = {35.f, 25.f};
+    auto& physics = entity.addComponent<PhysicsComponent>();
+    physics.clampToRoom = false;
+    physics.collisionHalfSize = {5.f, 5.f};
+    physics.velocity = {200.f, 0.f};
+
+    physicsSystem.update(entities, 0.1f);
+    REQUIRE(entity.position.x == Catch::Approx(45.f));
+    REQUIRE(physics.velocity.x == 0.f);
+}
@@ -15,56 +15,61 @@ TEST_CASE("HealthComponent initial state", "[component][health]") {
 }
 
 TEST_CASE("HealthComponent taking damage", "[component][health]") {
+    TimerWheel clock;
     HealthComponent health(3, 0.5f);
 
-    health.takeDamage(1);
+    health.takeDamage(1, clock);
 
     REQUIRE(health.current == 2);
     REQUIRE(health.isInvincible());
-    REQUIRE(health.invincibilityTimer == Catch::Approx(0.5f));
+    REQUIRE(health.invincibility.remaining() == Catch::Approx(0.5f));
 }
 
 TEST_CASE("HealthComponent invincibility blocks damage", "[component][health]") {
+    TimerWheel clock;
     HealthComponent health(3, 0.5f);
 
-    health.takeDamage(1);  // Takes damage, becomes invincible
-    health.takeDamage(1);  // Should be blocked
+    health.takeDamage(1, clock);  // Takes damage, becomes invincible
+    health.takeDamage(1, clock);  // Should be blocked
 
     REQUIRE(health.current == 2);  // Still 2, not 1
 }
 
 TEST_CASE("HealthComponent invincibility expires", "[component][health]") {
+    TimerWheel clock;
     HealthComponent health(3, 0.5f);
 
-    health.takeDamage(1);
+    health.takeDamage(1, clock);
     REQUIRE(health.isInvincible());
 
-    health.update(0.3f);
+    clock.advance(0.3f);
     REQUIRE(health.isInvincible());  // Still invincible
 
-    health.update(0.3f);  // Total 0.6f, past 0.5f duration
+    clock.advance(0.3f);  // Total 0.6f, past 0.5f duration
     REQUIRE_FALSE(health.isInvincible());
 
-    health.takeDamage(1);
+    health.takeDamage(1, clock);
     REQUIRE(health.current == 1);
 }
 
 TEST_CASE("HealthComponent death state", "[component][health]") {
+    TimerWheel clock;
     HealthComponent health(2, 0.0f);  // No invincibility for clean test
 
     REQUIRE(health.isAlive());
 
-    health.takeDamage(1);
+    health.takeDamage(1, clock);
     REQUIRE(health.isAlive());
 
-    health.takeDamage(1);
+    health.takeDamage(1, clock);
     REQUIRE_FALSE(health.isAlive());
 }
 
 TEST_CASE("HealthComponent overkill damage", "[component][health]") {
+    TimerWheel clock;
     HealthComponent health(3, 0.0f);
 
-    health.takeDamage(10);
+    health.takeDamage(10, clock);
 
     REQUIRE(health.current == -7);
     REQUIRE_FALSE(health.isAlive());
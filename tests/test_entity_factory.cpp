@@ -140,3 +140,18 @@ TEST_CASE("EntityFactory room bounds propagation", "[factory]") {
     REQUIRE(enemyPhysics->roomBounds.position.x == Catch::Approx(50.f));
     REQUIRE(enemyPhysics->roomBounds.size.x == Catch::Approx(700.f));
 }
+
+TEST_CASE("EntityFactory assigns interned texture ids", "[factory]") {
+    EntityManager manager;
+    sf::FloatRect bounds({0.f, 0.f}, {800.f, 600.f});
+
+    auto& player = EntityFactory::createPlayer(manager, {100.f, 100.f}, bounds);
+    auto& slime = EntityFactory::createEnemy(manager, EntityFactory::EnemyType::Slime, {200.f, 200.f}, bounds);
+    auto& bat = EntityFactory::createEnemy(manager, EntityFactory::EnemyType::Bat, {300.f, 200.f}, bounds);
+    auto& otherSlime = EntityFactory::createEnemy(manager, EntityFactory::EnemyType::Slime, {400.f, 200.f}, bounds);
+
+    REQUIRE(player.getComponent<SpriteComponent>()->textureId == intern("player"));
+    REQUIRE(slime.getComponent<SpriteComponent>()->textureId == intern("slime"));
+    REQUIRE(bat.getComponent<SpriteComponent>()->textureId == intern("bat"));
+    REQUIRE(otherSlime.getComponent<SpriteComponent>()->textureId == slime.getComponent<SpriteComponent>()->textureId);
+}
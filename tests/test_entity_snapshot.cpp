@@ -0,0 +1,76 @@
+#include <catch2/catch_all.hpp>
+#include "game/EntitySnapshot.hpp"
+#include "game/Room.hpp"
+
+namespace {
+
+const sf::FloatRect ROOM_BOUNDS({40.f, 40.f}, {720.f, 520.f});
+
+} // namespace
+
+// ============================================================================
+// EntitySnapshot Tests
+// ============================================================================
+
+TEST_CASE("captureEntities skips the player", "[snapshot]") {
+    EntityManager entities;
+    EntityFactory::createPlayer(entities, {100.f, 100.f}, ROOM_BOUNDS);
+
+    REQUIRE(captureEntities(entities).empty());
+}
+
+TEST_CASE("Snapshots round-trip enemy state", "[snapshot]") {
+    EntityManager entities;
+    Entity& bat = EntityFactory::createEnemy(entities, EntityFactory::EnemyType::Bat, {200.f, 150.f}, ROOM_BOUNDS);
+    bat.getComponent<PhysicsComponent>()->velocity = {3.f, -4.f};
+    bat.getComponent<AIComponent>()->blackboard[0] = 0.25f;
+    bat.getComponent<AIComponent>()->isChasing = true;
+
+    auto snapshots = captureEntities(entities);
+    REQUIRE(snapshots.size() == 1);
+
+    EntityManager restored;
+    restoreEntities(restored, snapshots, ROOM_BOUNDS);
+    REQUIRE(restored.countWith<EnemyTag>() == 1);
+
+    restored.forEachWith<EnemyTag>([](Entity& entity) {
+        REQUIRE(entity.getComponent<EnemyTag>()->type == static_cast<int>(EntityFactory::EnemyType::Bat));
+        REQUIRE(entity.position == sf::Vector2f{200.f, 150.f});
+        REQUIRE(entity.getComponent<PhysicsComponent>()->velocity == sf::Vector2f{3.f, -4.f});
+        REQUIRE(entity.getComponent<AIComponent>()->blackboard[0] == Catch::Approx(0.25f));
+        REQUIRE(entity.getComponent<AIComponent>()->isChasing);
+        REQUIRE(entity.getComponent<AIComponent>()->behavior == AIBehavior::Erratic);
+    });
+}
+
+TEST_CASE("Snapshots keep uncollected pickups", "[snapshot]") {
+    EntityManager entities;
+    EntityFactory::createHealthPickup(entities, {300.f, 300.f});
+    Entity& collected = EntityFactory::createHealthPickup(entities, {310.f, 300.f});
+    collected.getComponent<PickupComponent>()->collected = true;
+
+    auto snapshots = captureEntities(entities);
+    REQUIRE(snapshots.size() == 1);
+    REQUIRE(snapshots[0].kind == EntitySnapshot::Kind::Pickup);
+
+    EntityManager restored;
+    restoreEntities(restored, snapshots, ROOM_BOUNDS);
+    REQUIRE(restored.countWith<PickupTag>() == 1);
+}
+
+TEST_CASE("Snapshots skip dead enemies", "[snapshot]") {
+    EntityManager entities;
+    Entity& slime = EntityFactory::createEnemy(entities, EntityFactory::EnemyType::Slime, {200.f, 200.f}, ROOM_BOUNDS);
+    slime.getComponent<HealthComponent>()->current = 0;
+
+    REQUIRE(captureEntities(entities).empty());
+}
+
+TEST_CASE("Room keeps a saved snapshot", "[snapshot][room]") {
+    Room room(1, RoomType::Combat, {800.f, 600.f});
+    REQUIRE_FALSE(room.hasSnapshot());
+
+    room.saveSnapshot({});
+    REQUIRE(room.hasSnapshot());
+    REQUIRE(room.getSnapshot().empty());
+}
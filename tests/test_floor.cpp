@@ -51,10 +51,9 @@ TEST_CASE("Floor start room at origin", "[floor]") {
     const auto& positions = floor.getRoomPositions();
 
     // Room 0 (start) should be at grid position (0, 0)
-    auto it = positions.find(0);
-    REQUIRE(it != positions.end());
-    REQUIRE(it->second.x == 0);
-    REQUIRE(it->second.y == 0);
+    REQUIRE_FALSE(positions.empty());
+    REQUIRE(positions[0].x == 0);
+    REQUIRE(positions[0].y == 0);
 }
 
 TEST_CASE("Floor getCurrentRoom", "[floor]") {
@@ -179,3 +178,108 @@ TEST_CASE("Floor getFloorNumber", "[floor]") {
     REQUIRE(floor1.getFloorNumber() == 1);
     REQUIRE(floor5.getFloorNumber() == 5);
 }
+
+TEST_CASE("Floor with explicit room count", "[floor]") {
+    std::srand(12345);
+
+    Floor floor(1, {800.f, 600.f}, 200);
+
+    const auto& rooms = floor.getRooms();
+    REQUIRE(rooms.size() == 200);
+
+    // Ids index rooms directly, and every room is on the grid where it says
+    const auto& positions = floor.getRoomPositions();
+    for (int id = 0; id < 200; ++id) {
+        Room* room = floor.getRoom(id);
+        REQUIRE(room != nullptr);
+        REQUIRE(room->getId() == id);
+        REQUIRE(floor.getRoomAt(positions.at(id)) == id);
+    }
+}
+
+TEST_CASE("Floor depths follow the door graph", "[floor]") {
+    Floor floor(3, {800.f, 600.f}, 300);
+
+    REQUIRE(floor.getRoom(0)->getDepth() == 0);
+
+    // Each room other than the start has a neighbor exactly one door closer
+    for (const auto& room : floor.getRooms()) {
+        REQUIRE(room->getDepth() >= 0);
+        if (room->getId() == 0) continue;
+
+        bool hasParent = false;
+        for (const auto& door : room->getDoors()) {
+            const Room* neighbor = floor.getRoom(door.targetRoomId);
+            if (!neighbor) continue;
+            REQUIRE(std::abs(neighbor->getDepth() - room->getDepth()) <= 1);
+            if (neighbor->getDepth() == room->getDepth() - 1) hasParent = true;
+        }
+        REQUIRE(hasParent);
+    }
+}
+
+TEST_CASE("Floor exit is the deepest room", "[floor]") {
+    for (int i = 0; i < 20; ++i) {
+        Floor floor(1 + i % 3, {800.f, 600.f});
+
+        int exitId = floor.getExitRoomId();
+        REQUIRE(exitId > 0);
+        REQUIRE(floor.getRoom(exitId)->getType() == RoomType::Exit);
+
+        int maxDepth = 0;
+        for (const auto& room : floor.getRooms()) {
+            maxDepth = std::max(maxDepth, room->getDepth());
+        }
+        REQUIRE(floor.getRoom(exitId)->getDepth() == maxDepth);
+    }
+}
+
+TEST_CASE("Floor generates very large layouts", "[floor]") {
+    Floor floor(1, {800.f, 600.f}, 10000);
+
+    REQUIRE(floor.getRooms().size() == 10000);
+    REQUIRE(floor.getRoom(floor.getExitRoomId())->getType() == RoomType::Exit);
+}
+
+TEST_CASE("Floor with the same seed has the same layout", "[floor]") {
+    Floor a(2, {800.f, 600.f}, 50, 777);
+    Floor b(2, {800.f, 600.f}, 50, 777);
+
+    REQUIRE(a.getRoomPositions() == b.getRoomPositions());
+    REQUIRE(a.getExitRoomId() == b.getExitRoomId());
+    REQUIRE(a.getRoomSeed(3) == b.getRoomSeed(3));
+}
+
+TEST_CASE("Floor pre-rolls spawns for combat rooms", "[floor]") {
+    Floor floor(2, {800.f, 600.f}, 30, 4242);
+
+    for (const auto& room : floor.getRooms()) {
+        const auto& plan = room->getSpawnPlan();
+        if (room->getType() != RoomType::Combat) {
+            REQUIRE(plan.empty());
+            continue;
+        }
+
+        // 2 + floor / 2 to 4 + floor / 2 enemies, inside the room
+        REQUIRE(plan.size() >= 3);
+        REQUIRE(plan.size() <= 5);
+        for (const auto& spawn : plan) {
+            REQUIRE(room->getBounds().contains(spawn.position));
+        }
+    }
+}
+
+TEST_CASE("Floor spawn plans are reproducible", "[floor]") {
+    Floor a(1, {800.f, 600.f}, 20, 99);
+    Floor b(1, {800.f, 600.f}, 20, 99);
+
+    for (int id = 0; id < 20; ++id) {
+        const auto& planA = a.getRoom(id)->getSpawnPlan();
+        const auto& planB = b.getRoom(id)->getSpawnPlan();
+        REQUIRE(planA.size() == planB.size());
+        for (size_t i = 0; i < planA.size(); ++i) {
+            REQUIRE(planA[i].type == planB[i].type);
+            REQUIRE(planA[i].position == planB[i].position);
+        }
+    }
+}
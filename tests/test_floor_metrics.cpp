@@ -0,0 +1,65 @@
+#include <catch2/catch_all.hpp>
+#include "game/FloorMetrics.hpp"
+#include <algorithm>
+#include <vector>
+
+// ============================================================================
+// FloorMetrics Tests
+// ============================================================================
+
+TEST_CASE("FloorMetrics for a two-room floor", "[floormetrics]") {
+    Floor floor(1, {800.f, 600.f}, 2, 1);
+
+    FloorMetrics metrics = computeFloorMetrics(floor);
+
+    REQUIRE(metrics.roomCount == 2);
+    REQUIRE(metrics.exitDepth == 1);
+    REQUIRE(metrics.deadEnds == 1);  // The exit; the start doesn't count
+    REQUIRE(metrics.branchRooms == 0);
+}
+
+TEST_CASE("FloorMetrics agree with the floor", "[floormetrics]") {
+    Floor floor(3, {800.f, 600.f}, 60, 2024);
+
+    FloorMetrics metrics = computeFloorMetrics(floor);
+
+    REQUIRE(metrics.roomCount == 60);
+    REQUIRE(metrics.exitDepth == floor.getRoom(floor.getExitRoomId())->getDepth());
+    REQUIRE(metrics.deadEnds + metrics.branchRooms <= 60);
+}
+
+TEST_CASE("SeedIndexRecord sorts by exit depth first", "[floormetrics]") {
+    std::vector<SeedIndexRecord> records(3);
+    records[0].seed = 1;
+    records[0].metrics.exitDepth = 5;
+    records[1].seed = 2;
+    records[1].metrics.exitDepth = 2;
+    records[1].metrics.roomCount = 9;
+    records[2].seed = 3;
+    records[2].metrics.exitDepth = 2;
+    records[2].metrics.roomCount = 4;
+
+    std::sort(records.begin(), records.end());
+
+    REQUIRE(records[0].seed == 3);
+    REQUIRE(records[1].seed == 2);
+    REQUIRE(records[2].seed == 1);
+}
+
+TEST_CASE("FloorQuery matches inclusive ranges", "[floormetrics]") {
+    FloorQuery query;
+    query.exitDepth = {3, 5};
+    query.deadEnds.min = 2;
+
+    FloorMetrics metrics;
+    metrics.exitDepth = 3;
+    metrics.deadEnds = 2;
+    REQUIRE(query.matches(metrics));
+
+    metrics.exitDepth = 6;
+    REQUIRE_FALSE(query.matches(metrics));
+
+    metrics.exitDepth = 5;
+    metrics.deadEnds = 1;
+    REQUIRE_FALSE(query.matches(metrics));
+}
@@ -0,0 +1,78 @@
+#include <catch2/catch_all.hpp>
+#include "game/GridMap.hpp"
+
+// ============================================================================
+// GridMap Tests
+// ============================================================================
+
+TEST_CASE("GridMap starts empty", "[gridmap]") {
+    GridMap map;
+
+    REQUIRE(map.size() == 0);
+    REQUIRE(map.find({0, 0}) == GridMap::NONE);
+    REQUIRE_FALSE(map.contains({3, -2}));
+}
+
+TEST_CASE("GridMap insert and find", "[gridmap]") {
+    GridMap map;
+    map.insert({0, 0}, 0);
+    map.insert({1, 0}, 1);
+    map.insert({0, -1}, 2);
+
+    REQUIRE(map.size() == 3);
+    REQUIRE(map.find({0, 0}) == 0);
+    REQUIRE(map.find({1, 0}) == 1);
+    REQUIRE(map.find({0, -1}) == 2);
+    REQUIRE(map.find({-1, 0}) == GridMap::NONE);
+}
+
+TEST_CASE("GridMap insert overwrites existing cells", "[gridmap]") {
+    GridMap map;
+    map.insert({5, 5}, 1);
+    map.insert({5, 5}, 7);
+
+    REQUIRE(map.size() == 1);
+    REQUIRE(map.find({5, 5}) == 7);
+}
+
+TEST_CASE("GridMap keeps negative coordinates distinct", "[gridmap]") {
+    GridMap map;
+    map.insert({-1, 1}, 1);
+    map.insert({1, -1}, 2);
+    map.insert({-1, -1}, 3);
+
+    REQUIRE(map.find({-1, 1}) == 1);
+    REQUIRE(map.find({1, -1}) == 2);
+    REQUIRE(map.find({-1, -1}) == 3);
+    REQUIRE(map.find({1, 1}) == GridMap::NONE);
+}
+
+TEST_CASE("GridMap grows past its initial capacity", "[gridmap]") {
+    GridMap map;
+    int value = 0;
+    for (int y = -50; y < 50; ++y) {
+        for (int x = -50; x < 50; ++x) {
+            map.insert({x, y}, value++);
+        }
+    }
+
+    REQUIRE(map.size() == 10000);
+    value = 0;
+    for (int y = -50; y < 50; ++y) {
+        for (int x = -50; x < 50; ++x) {
+            REQUIRE(map.find({x, y}) == value++);
+        }
+    }
+    REQUIRE(map.find({50, 0}) == GridMap::NONE);
+}
+
+TEST_CASE("GridMap clear removes everything", "[gridmap]") {
+    GridMap map;
+    map.reserve(100);
+    for (int i = 0; i < 100; ++i) map.insert({i, i}, i);
+
+    map.clear();
+
+    REQUIRE(map.size() == 0);
+    REQUIRE(map.find({10, 10}) == GridMap::NONE);
+}
@@ -0,0 +1,106 @@
+#include <catch2/catch_all.hpp>
+#include "game/LineOfSight.hpp"
+#include "ecs/Systems.hpp"
+
+namespace {
+
+// 10x10 tiles with the grid's origin at (0, 0)
+const sf::FloatRect AREA({0.f, 0.f}, {RoomTemplate::COLS * 10.f, RoomTemplate::ROWS * 10.f});
+
+sf::Vector2f tileCenter(int col, int row) {
+    return {col * 10.f + 5.f, row * 10.f + 5.f};
+}
+
+RoomTemplate makeLayout(std::initializer_list<std::pair<int, int>> cells, TileType type) {
+    RoomTemplate layout;
+    layout.tiles.fill(TileType::Floor);
+    for (auto [col, row] : cells) {
+        layout.tiles[row * RoomTemplate::COLS + col] = type;
+    }
+    return layout;
+}
+
+} // namespace
+
+// ============================================================================
+// LineOfSight Tests
+// ============================================================================
+
+TEST_CASE("LineOfSight is blocked by walls but not pits", "[los]") {
+    CollisionGrid walls(makeLayout({{5, 0}, {5, 1}, {5, 2}, {5, 3}, {5, 4}}, TileType::Wall), AREA);
+    LineOfSight sight;
+    sight.setGrid(&walls);
+    sight.setTarget(tileCenter(8, 2));
+
+    REQUIRE_FALSE(sight.canSee(tileCenter(2, 2)));
+    REQUIRE_FALSE(sight.canSee(tileCenter(2, 8)));  // Diagonal clips the wall's corner
+    REQUIRE(sight.canSee(tileCenter(8, 10)));       // Same side
+    REQUIRE(sight.canSee(tileCenter(5, 9)));        // Below the end of the wall
+
+    CollisionGrid pits(makeLayout({{5, 0}, {5, 1}, {5, 2}, {5, 3}, {5, 4}}, TileType::Pit), AREA);
+    sight.setGrid(&pits);
+    sight.setTarget(tileCenter(8, 2));
+    REQUIRE(sight.canSee(tileCenter(2, 2)));
+}
+
+TEST_CASE("LineOfSight does not slip through diagonal gaps", "[los]") {
+    CollisionGrid grid(makeLayout({{1, 0}, {0, 1}}, TileType::Wall), AREA);
+    LineOfSight sight;
+    sight.setGrid(&grid);
+    sight.setTarget(tileCenter(1, 1));
+
+    REQUIRE_FALSE(sight.canSee(tileCenter(0, 0)));
+}
+
+TEST_CASE("LineOfSight shares results per tile until the target changes tile", "[los]") {
+    CollisionGrid grid(makeLayout({{15, 1}}, TileType::Wall), AREA);
+    LineOfSight sight;
+    sight.setGrid(&grid);
+
+    sight.setTarget({12.f, 12.f});
+    REQUIRE(sight.canSee({150.f, 100.f}));
+    REQUIRE(sight.canSee({152.f, 104.f}));  // Same tile as above
+    REQUIRE(sight.getRaycastCount() == 1);
+
+    sight.setTarget({18.f, 14.f});  // Moved, but within the same tile
+    REQUIRE(sight.canSee({151.f, 101.f}));
+    REQUIRE(sight.getRaycastCount() == 1);
+
+    sight.setTarget({25.f, 14.f});  // Next tile over
+    REQUIRE(sight.canSee({151.f, 101.f}));
+    REQUIRE(sight.getRaycastCount() == 2);
+}
+
+TEST_CASE("LineOfSight without walls never traces", "[los]") {
+    CollisionGrid grid;
+    LineOfSight sight;
+    sight.setGrid(&grid);
+    sight.setTarget({0.f, 0.f});
+
+    REQUIRE(sight.canSee({100.f, 100.f}));
+    REQUIRE(sight.getRaycastCount() == 0);
+}
+
+TEST_CASE("AISystem agents do not notice the player through walls", "[los][system]") {
+    CollisionGrid grid(makeLayout({{5, 0}, {5, 1}, {5, 2}, {5, 3}, {5, 4}}, TileType::Wall), AREA);
+    LineOfSight sight;
+    sight.setGrid(&grid);
+
+    AISystem aiSystem;
+    aiSystem.setLineOfSight(&sight);
+
+    EntityManager manager;
+    auto& hidden = manager.createEntity();
+    hidden.position = tileCenter(2, 2);
+    hidden.addComponent<AIComponent>();
+    hidden.addComponent<PhysicsComponent>();
+
+    auto& visible = manager.createEntity();
+    visible.position = tileCenter(8, 9);
+    visible.addComponent<AIComponent>();
+    visible.addComponent<PhysicsComponent>();
+
+    aiSystem.update(manager, 0.016f, tileCenter(8, 2));
+    REQUIRE_FALSE(hidden.getComponent<AIComponent>()->isChasing);
+    REQUIRE(visible.getComponent<AIComponent>()->isChasing);
+}
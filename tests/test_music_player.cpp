@@ -0,0 +1,97 @@
+#include <catch2/catch_all.hpp>
+#include "audio/MusicPlayer.hpp"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace {
+
+// Tracks named "slow..." block on the worker until released
+std::atomic<bool> slowReleased{false};
+
+MusicPlayer::Source lookupTrack(StringId track) {
+    MusicPlayer::Source source;
+    std::string name = StringInterner::instance().str(track);
+    if (name.rfind("track", 0) == 0 || name.rfind("slow", 0) == 0) source.path = name;
+    return source;
+}
+
+std::unique_ptr<sf::Music> openTrack(const MusicPlayer::Source& source) {
+    if (source.path.rfind("slow", 0) == 0) {
+        while (!slowReleased) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return std::make_unique<sf::Music>();
+}
+
+template<typename Condition>
+bool pump(MusicPlayer& player, Condition done) {
+    for (int i = 0; i < 2000 && !done(); ++i) {
+        player.update(0.f);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return done();
+}
+
+} // namespace
+
+// ============================================================================
+// MusicPlayer Tests
+// ============================================================================
+
+TEST_CASE("MusicPlayer starts a queued track once it is open", "[audio][music]") {
+    MusicPlayer player(lookupTrack, openTrack);
+    StringId track = intern("track_a");
+
+    player.crossfadeTo(track, 0.5f);
+    REQUIRE(pump(player, [&]() { return player.getCurrentTrack() == track; }));
+    REQUIRE(player.isFading());
+
+    player.update(1.f);
+    REQUIRE_FALSE(player.isFading());
+    REQUIRE_FALSE(player.isPrefetched(track));
+}
+
+TEST_CASE("MusicPlayer keeps a prefetch when a queued track arrives later", "[audio][music]") {
+    slowReleased = false;
+    MusicPlayer player(lookupTrack, openTrack);
+    StringId current = intern("slow_floor1");
+    StringId next = intern("track_floor2");
+
+    player.crossfadeTo(current);
+    player.prefetch(next);
+    REQUIRE(pump(player, [&]() { return player.isPrefetched(next); }));
+
+    slowReleased = true;
+    REQUIRE(pump(player, [&]() { return !player.isPrefetching(); }));
+    REQUIRE(player.getCurrentTrack() == current);
+    REQUIRE(player.isPrefetched(next));
+
+    // The prefetched track starts without waiting on another open
+    player.crossfadeTo(next);
+    REQUIRE(player.getCurrentTrack() == next);
+    REQUIRE_FALSE(player.isPrefetched(next));
+}
+
+TEST_CASE("MusicPlayer closes the oldest unused prefetch past the limit", "[audio][music]") {
+    MusicPlayer player(lookupTrack, openTrack);
+    for (size_t i = 0; i <= MusicPlayer::MAX_PREFETCHED; ++i) {
+        player.prefetch(intern("track_" + std::to_string(i)));
+        REQUIRE(pump(player, [&]() { return !player.isPrefetching(); }));
+    }
+
+    REQUIRE_FALSE(player.isPrefetched(intern("track_0")));
+    for (size_t i = 1; i <= MusicPlayer::MAX_PREFETCHED; ++i) {
+        REQUIRE(player.isPrefetched(intern("track_" + std::to_string(i))));
+    }
+}
+
+TEST_CASE("MusicPlayer fades unknown tracks to silence", "[audio][music]") {
+    MusicPlayer player(lookupTrack, openTrack);
+    player.crossfadeTo(intern("track_a"));
+    REQUIRE(pump(player, [&]() { return !player.getCurrentTrack().empty(); }));
+
+    player.crossfadeTo(intern("missing"));
+    REQUIRE(player.getCurrentTrack().empty());
+    REQUIRE(player.isFading());
+    REQUIRE_FALSE(player.isPrefetching());
+}
@@ -0,0 +1,254 @@
+#include <catch2/catch_all.hpp>
+#include "ecs/Projectiles.hpp"
+#include "ecs/Systems.hpp"
+#include "ecs/EntityFactory.hpp"
+
+namespace {
+
+// 32x32 tiles with the grid's origin at (0, 0)
+const sf::FloatRect AREA({0.f, 0.f}, {RoomTemplate::COLS * 32.f, RoomTemplate::ROWS * 32.f});
+
+RoomTemplate makeLayout(std::initializer_list<std::pair<int, int>> cells, TileType type) {
+    RoomTemplate layout;
+    layout.tiles.fill(TileType::Floor);
+    for (auto [col, row] : cells) {
+        layout.tiles[row * RoomTemplate::COLS + col] = type;
+    }
+    return layout;
+}
+
+Entity& createTarget(EntityManager& manager, sf::Vector2f position, bool player) {
+    Entity& entity = manager.createEntity();
+    entity.position = position;
+    entity.addComponent<HealthComponent>(3, 0.f);
+    entity.addComponent<HurtboxComponent>(sf::Vector2f{32.f, 32.f});
+    if (player) {
+        entity.addComponent<PlayerControlComponent>();
+    } else {
+        entity.addComponent<EnemyTag>();
+    }
+    return entity;
+}
+
+} // namespace
+
+// ============================================================================
+// ProjectilePool Tests
+// ============================================================================
+
+TEST_CASE("ProjectilePool spawns up to capacity", "[projectile]") {
+    ProjectilePool pool(4);
+    for (int i = 0; i < 4; ++i) {
+        REQUIRE(pool.spawn({1.f * i, 0.f}, {10.f, 0.f}, 1.f, 1, Faction::Enemy));
+    }
+    REQUIRE_FALSE(pool.spawn({0.f, 0.f}, {10.f, 0.f}, 1.f, 1, Faction::Enemy));
+    REQUIRE(pool.size() == 4);
+    REQUIRE(pool.getMaxSpeed() == Catch::Approx(10.f));
+
+    pool.clear();
+    REQUIRE(pool.empty());
+    REQUIRE(pool.capacity() == 4);
+}
+
+TEST_CASE("ProjectilePool remove swaps in the last projectile", "[projectile]") {
+    ProjectilePool pool(8);
+    pool.spawn({0.f, 0.f}, {1.f, 0.f}, 1.f, 1, Faction::Enemy, 7);
+    pool.spawn({1.f, 0.f}, {2.f, 0.f}, 2.f, 2, Faction::Enemy, 8);
+    pool.spawn({2.f, 0.f}, {3.f, 0.f}, 3.f, 3, Faction::Player, 9);
+
+    pool.remove(0);
+    REQUIRE(pool.size() == 2);
+    REQUIRE(pool.posX[0] == 2.f);
+    REQUIRE(pool.velX[0] == 3.f);
+    REQUIRE(pool.life[0] == 3.f);
+    REQUIRE(pool.damage[0] == 3);
+    REQUIRE(pool.owner[0] == 9);
+    REQUIRE(pool.faction[0] == Faction::Player);
+    REQUIRE(pool.posX[1] == 1.f);
+}
+
+TEST_CASE("Projectile integrator matches the scalar kernel", "[projectile]") {
+    ProjectilePool scalar(64), dispatched(64);
+    for (int i = 0; i < 37; ++i) {  // Not a multiple of 8, so the tail runs too
+        sf::Vector2f pos{i * 3.7f, i * -1.3f};
+        sf::Vector2f vel{i * 11.f - 200.f, 150.f - i * 7.f};
+        scalar.spawn(pos, vel, 2.f, 1, Faction::Enemy);
+        dispatched.spawn(pos, vel, 2.f, 1, Faction::Enemy);
+    }
+
+    integrateProjectilesScalar(scalar, 1.f / 60.f);
+    integrateProjectiles(dispatched, 1.f / 60.f);
+
+    for (size_t i = 0; i < scalar.size(); ++i) {
+        REQUIRE(dispatched.posX[i] == scalar.posX[i]);
+        REQUIRE(dispatched.posY[i] == scalar.posY[i]);
+        REQUIRE(dispatched.life[i] == scalar.life[i]);
+    }
+    REQUIRE(scalar.posX[36] == Catch::Approx(36 * 3.7f + (36 * 11.f - 200.f) / 60.f));
+}
+
+// ============================================================================
+// TargetGrid Tests
+// ============================================================================
+
+TEST_CASE("TargetGrid lists a box in every cell it covers", "[projectile]") {
+    TargetGrid grid;
+    std::vector<sf::FloatRect> boxes{
+        sf::FloatRect({50.f, 50.f}, {40.f, 40.f}),    // Spans cells (0,0) to (1,1)
+        sf::FloatRect({200.f, 10.f}, {10.f, 10.f}),
+        sf::FloatRect({-100.f, -100.f}, {10.f, 10.f}),  // Outside the area
+    };
+    grid.build(boxes, sf::FloatRect({0.f, 0.f}, {256.f, 256.f}), 64.f);
+
+    auto at = [&grid](float x, float y) {
+        std::vector<std::uint32_t> found;
+        grid.forEachAt(x, y, [&found](std::uint32_t b) { found.push_back(b); });
+        return found;
+    };
+
+    REQUIRE(at(10.f, 10.f) == std::vector<std::uint32_t>{0});
+    REQUIRE(at(80.f, 80.f) == std::vector<std::uint32_t>{0});
+    REQUIRE(at(200.f, 60.f) == std::vector<std::uint32_t>{1});
+    REQUIRE(at(150.f, 150.f).empty());
+    REQUIRE(at(-50.f, 10.f).empty());
+}
+
+// ============================================================================
+// ProjectileSystem Tests
+// ============================================================================
+
+TEST_CASE("ProjectileSystem damages targets of the other faction", "[projectile]") {
+    TimerWheel clock;
+    EntityManager manager;
+    ProjectileSystem projectiles(clock);
+    CollisionGrid grid;
+    projectiles.setRoom(&grid, AREA);
+
+    Entity& player = createTarget(manager, {200.f, 100.f}, true);
+    Entity& enemy = createTarget(manager, {100.f, 100.f}, false);
+
+    // Enemy shot starting inside the enemy flies right into the player
+    projectiles.getPool().spawn({100.f, 100.f}, {300.f, 0.f}, 2.f, 1, Faction::Enemy, enemy.getId());
+    for (int i = 0; i < 30; ++i) projectiles.update(manager, 1.f / 60.f, player.position);
+
+    REQUIRE(enemy.getComponent<HealthComponent>()->current == 3);
+    REQUIRE(player.getComponent<HealthComponent>()->current == 2);
+    REQUIRE(projectiles.getPool().empty());
+}
+
+TEST_CASE("ProjectileSystem stops projectiles at walls and room edges", "[projectile]") {
+    TimerWheel clock;
+    EntityManager manager;
+    ProjectileSystem projectiles(clock);
+    CollisionGrid grid(makeLayout({{5, 3}}, TileType::Wall), AREA);
+    projectiles.setRoom(&grid, AREA);
+
+    Entity& player = createTarget(manager, {240.f, 112.f}, true);  // Behind the wall at x 160..192
+
+    auto& pool = projectiles.getPool();
+    pool.spawn({100.f, 112.f}, {300.f, 0.f}, 5.f, 1, Faction::Enemy);
+    pool.spawn({100.f, 300.f}, {0.f, 300.f}, 5.f, 1, Faction::Enemy);  // Leaves through the bottom
+    pool.spawn({100.f, 200.f}, {0.f, 0.f}, 0.5f, 1, Faction::Enemy);   // Fizzles
+
+    projectiles.update(manager, 1.f / 60.f, player.position);
+    REQUIRE(pool.size() == 3);
+
+    for (int i = 0; i < 60; ++i) projectiles.update(manager, 1.f / 60.f, player.position);
+    REQUIRE(pool.empty());
+    REQUIRE(player.getComponent<HealthComponent>()->current == 3);
+}
+
+TEST_CASE("ProjectileSystem substeps fast projectiles", "[projectile]") {
+    TimerWheel clock;
+    EntityManager manager;
+    ProjectileSystem projectiles(clock);
+    CollisionGrid grid;
+    projectiles.setRoom(&grid, AREA);
+
+    Entity& enemy = createTarget(manager, {300.f, 100.f}, false);
+
+    // 40px per tick would jump clean over the 38px grown box between ticks
+    projectiles.getPool().spawn({280.f, 100.f}, {2400.f, 0.f}, 1.f, 1, Faction::Player);
+    projectiles.update(manager, 1.f / 60.f, {0.f, 0.f});
+
+    REQUIRE(enemy.getComponent<HealthComponent>()->current == 2);
+}
+
+TEST_CASE("ProjectileSystem kills enemies and emits EnemyDiedEvent", "[projectile]") {
+    TimerWheel clock;
+    EntityManager manager;
+    ProjectileSystem projectiles(clock);
+    CollisionGrid grid;
+    projectiles.setRoom(&grid, AREA);
+
+    Entity& enemy = createTarget(manager, {300.f, 100.f}, false);
+    enemy.getComponent<HealthComponent>()->current = 1;
+
+    unsigned int died = 0;
+    EventBus::instance().clear();
+    EventBus::instance().subscribe<EnemyDiedEvent>([&died](const EnemyDiedEvent& event) {
+        died = event.entityId;
+    });
+
+    // Two shots, but the second must not hit a dead enemy
+    projectiles.getPool().spawn({290.f, 100.f}, {0.f, 0.f}, 1.f, 1, Faction::Player);
+    projectiles.getPool().spawn({310.f, 100.f}, {0.f, 0.f}, 1.f, 1, Faction::Player);
+    projectiles.update(manager, 1.f / 60.f, {0.f, 0.f});
+
+    REQUIRE_FALSE(enemy.active);
+    REQUIRE(died == enemy.getId());
+    REQUIRE(projectiles.getPool().size() == 1);
+
+    EventBus::instance().clear();  // The handler refers to this test's locals
+}
+
+TEST_CASE("ProjectileSystem keeps 20k projectiles in flight", "[projectile]") {
+    TimerWheel clock;
+    EntityManager manager;
+    ProjectileSystem projectiles(clock);
+    CollisionGrid grid;
+    projectiles.setRoom(&grid, AREA);
+    createTarget(manager, {500.f, 380.f}, true);
+
+    auto& pool = projectiles.getPool();
+    for (int i = 0; i < 20000; ++i) {
+        float x = 20.f + (i % 200) * 2.f;
+        float y = 20.f + (i / 200) * 2.f;
+        REQUIRE(pool.spawn({x, y}, {10.f, 5.f}, 10.f, 1, Faction::Enemy));
+    }
+
+    for (int i = 0; i < 10; ++i) projectiles.update(manager, 1.f / 60.f, {500.f, 380.f});
+    REQUIRE(pool.size() == 20000);
+}
+
+TEST_CASE("Archers fire volleys while chasing", "[projectile]") {
+    TimerWheel clock;
+    EntityManager manager;
+    ProjectileSystem projectiles(clock);
+    CollisionGrid grid;
+    projectiles.setRoom(&grid, AREA);
+
+    Entity& archer = EntityFactory::createEnemy(manager, EntityFactory::EnemyType::Archer, {100.f, 100.f}, AREA);
+    auto* ranged = archer.getComponent<RangedAttackComponent>();
+    REQUIRE(ranged != nullptr);
+
+    projectiles.update(manager, 1.f / 60.f, {300.f, 100.f});
+    REQUIRE(projectiles.getPool().empty());  // Has not noticed the player
+
+    archer.getComponent<AIComponent>()->isChasing = true;
+    projectiles.update(manager, 1.f / 60.f, {300.f, 100.f});
+    REQUIRE(projectiles.getPool().size() == static_cast<size_t>(ranged->shots));
+    REQUIRE(ranged->reload.isPending());
+
+    // Reloading
+    projectiles.update(manager, 1.f / 60.f, {300.f, 100.f});
+    REQUIRE(projectiles.getPool().size() == static_cast<size_t>(ranged->shots));
+
+    // The middle shot flies straight at the player
+    auto& pool = projectiles.getPool();
+    bool aimed = false;
+    for (size_t i = 0; i < pool.size(); ++i) {
+        if (std::abs(pool.velY[i]) < 0.01f && pool.velX[i] > 0.f) aimed = true;
+    }
+    REQUIRE(aimed);
+}
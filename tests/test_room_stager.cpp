@@ -0,0 +1,89 @@
+#include <catch2/catch_all.hpp>
+#include "game/RoomStager.hpp"
+#include <deque>
+
+namespace {
+
+const sf::Vector2f ROOM_SIZE{800.f, 600.f};
+
+Room& addCombatRoom(std::deque<Room>& rooms, int enemies) {
+    Room& room = rooms.emplace_back(static_cast<int>(rooms.size()), RoomType::Combat, ROOM_SIZE);
+    std::vector<SpawnPoint> plan;
+    for (int i = 0; i < enemies; ++i) {
+        plan.push_back({EntityFactory::EnemyType::Bat, {200.f + 50.f * i, 200.f}});
+    }
+    room.setSpawnPlan(std::move(plan));
+    return room;
+}
+
+} // namespace
+
+// ============================================================================
+// RoomStager Tests
+// ============================================================================
+
+TEST_CASE("RoomStager spawns the plan on a first visit", "[stager]") {
+    std::deque<Room> rooms;
+    Room& room = addCombatRoom(rooms, 3);
+    RoomStager stager;
+    EntityManager live;
+    live.createEntity();  // Left over from the previous room
+
+    stager.swapInto(room, live);
+
+    REQUIRE(live.count() == 3);
+    REQUIRE(live.countWith<EnemyTag>() == 3);
+    REQUIRE(stager.getStagedRoomId() == -1);
+    REQUIRE(stager.getStaging().count() == 0);
+}
+
+TEST_CASE("RoomStager restores a revisited room from its snapshot", "[stager]") {
+    std::deque<Room> rooms;
+    Room& room = addCombatRoom(rooms, 3);
+
+    EntityManager left;
+    EntityFactory::createEnemy(left, EntityFactory::EnemyType::Slime, {300.f, 300.f}, room.getBounds());
+    EntityFactory::createPickup(left, PickupType::Health, 1, {400.f, 300.f});
+    room.saveSnapshot(captureEntities(left));
+
+    RoomStager stager;
+    stager.stage(room);
+    REQUIRE(stager.getStagedRoomId() == room.getId());
+
+    EntityManager live;
+    stager.swapInto(room, live);
+
+    // The snapshot wins over the spawn plan
+    REQUIRE(live.countWith<EnemyTag>() == 1);
+    REQUIRE(live.countWith<PickupComponent>() == 1);
+}
+
+TEST_CASE("RoomStager replaces a stale stage at a different door", "[stager]") {
+    std::deque<Room> rooms;
+    Room& start = rooms.emplace_back(0, RoomType::Start, ROOM_SIZE);
+    Room& north = addCombatRoom(rooms, 1);
+    Room& east = addCombatRoom(rooms, 2);
+    start.connectDoor(Direction::North, north.getId());
+    start.connectDoor(Direction::East, east.getId());
+
+    EntityManager none;
+    start.update(none);  // Start rooms unlock their doors
+    RoomStager::FindRoom find = [&rooms](int id) { return &rooms[id]; };
+    RoomStager stager;
+
+    stager.stageNearDoor(start, {400.f, 400.f}, 120.f, find);  // Near no door
+    REQUIRE(stager.getStagedRoomId() == -1);
+
+    stager.stageNearDoor(start, {400.f, 90.f}, 120.f, find);
+    REQUIRE(stager.getStagedRoomId() == north.getId());
+    REQUIRE(stager.getStaging().countWith<EnemyTag>() == 1);
+
+    stager.stageNearDoor(start, {720.f, 300.f}, 120.f, find);
+    REQUIRE(stager.getStagedRoomId() == east.getId());
+    REQUIRE(stager.getStaging().countWith<EnemyTag>() == 2);
+
+    // Entering east uses the stage as is
+    EntityManager live;
+    stager.swapInto(east, live);
+    REQUIRE(live.countWith<EnemyTag>() == 2);
+}
@@ -0,0 +1,125 @@
+#include <catch2/catch_all.hpp>
+#include "game/RoomTemplate.hpp"
+#include "game/Floor.hpp"
+
+namespace {
+
+const char* PILLARS =
+    "[pillars]\n"
+    "weight 3\n"
+    "spawns bat 1\n"
+    "..................\n"
+    "..S............S..\n"
+    "...##........##...\n"
+    "...##........##...\n"
+    "..................\n"
+    "..................\n"
+    "........OO........\n"
+    "..................\n"
+    "..................\n"
+    "...##........##...\n"
+    "...##........##...\n"
+    "..S............S..\n"
+    "..................\n";
+
+// Restores the built-in-only library, since it is process-wide
+struct LibraryGuard {
+    ~LibraryGuard() { RoomTemplateLibrary::instance().parse(""); }
+};
+
+} // namespace
+
+// ============================================================================
+// RoomTemplateLibrary Tests
+// ============================================================================
+
+TEST_CASE("RoomTemplateLibrary always has the open template", "[roomtemplate]") {
+    LibraryGuard guard;
+    RoomTemplateLibrary::instance().parse("");
+
+    const auto& open = RoomTemplateLibrary::instance().getOpen();
+    REQUIRE(open.name == "open");
+    REQUIRE(open.at(0, 0) == TileType::Floor);
+    REQUIRE(open.spawnCells.empty());
+    REQUIRE(RoomTemplateLibrary::instance().getTemplates().size() == 1);
+}
+
+TEST_CASE("RoomTemplateLibrary parses tiles, spawns and weights", "[roomtemplate]") {
+    LibraryGuard guard;
+    REQUIRE(RoomTemplateLibrary::instance().parse(PILLARS));
+
+    const auto& templates = RoomTemplateLibrary::instance().getTemplates();
+    REQUIRE(templates.size() == 2);
+
+    const RoomTemplate& pillars = templates[1];
+    REQUIRE(pillars.name == "pillars");
+    REQUIRE(pillars.weight == 3);
+    REQUIRE(pillars.at(3, 2) == TileType::Wall);
+    REQUIRE(pillars.at(8, 6) == TileType::Pit);
+    REQUIRE(pillars.at(0, 0) == TileType::Floor);
+    REQUIRE(pillars.at(-1, 0) == TileType::Wall);  // Outside counts as wall
+    REQUIRE(pillars.spawnCells.size() == 4);
+    REQUIRE(pillars.spawnTable.size() == 1);
+
+    util::Pcg32 rng(1);
+    REQUIRE(pillars.pickEnemy(rng) == EntityFactory::EnemyType::Bat);
+}
+
+TEST_CASE("RoomTemplateLibrary rejects broken templates", "[roomtemplate]") {
+    LibraryGuard guard;
+
+    SECTION("Too few rows") {
+        REQUIRE_FALSE(RoomTemplateLibrary::instance().parse("[short]\n..................\n"));
+    }
+
+    SECTION("Blocked doorway") {
+        std::string blocked = PILLARS;
+        blocked.replace(blocked.find("..................\n"), 18, "........##........");
+        REQUIRE_FALSE(RoomTemplateLibrary::instance().parse(blocked));
+    }
+
+    SECTION("Unknown tile") {
+        std::string unknown = PILLARS;
+        unknown.replace(unknown.find("..S"), 3, "..X");
+        REQUIRE_FALSE(RoomTemplateLibrary::instance().parse(unknown));
+    }
+
+    SECTION("Unknown enemy") {
+        std::string unknown = PILLARS;
+        unknown.replace(unknown.find("spawns bat 1"), 12, "spawns imp 1");
+        REQUIRE_FALSE(RoomTemplateLibrary::instance().parse(unknown));
+    }
+
+    SECTION("Enemy without a weight") {
+        std::string dangling = PILLARS;
+        dangling.replace(dangling.find("spawns bat 1"), 12, "spawns bat 1 slime");
+        REQUIRE_FALSE(RoomTemplateLibrary::instance().parse(dangling));
+    }
+
+    REQUIRE(RoomTemplateLibrary::instance().getTemplates().size() == 1);
+}
+
+TEST_CASE("Floor spawns enemies on template spawn points", "[roomtemplate][floor]") {
+    LibraryGuard guard;
+    REQUIRE(RoomTemplateLibrary::instance().parse(PILLARS));
+
+    Floor floor(1, {800.f, 600.f}, 40, 5);
+
+    for (const auto& room : floor.getRooms()) {
+        if (room->getType() != RoomType::Combat) {
+            REQUIRE(room->getLayout().name == "open");
+            continue;
+        }
+
+        const RoomTemplate& layout = room->getLayout();
+        sf::Vector2f tile = room->getTileSize();
+        for (const auto& spawn : room->getSpawnPlan()) {
+            int col = static_cast<int>((spawn.position.x - room->getBounds().position.x) / tile.x);
+            int row = static_cast<int>((spawn.position.y - room->getBounds().position.y) / tile.y);
+            REQUIRE(layout.at(col, row) == TileType::Floor);
+            if (layout.name == "pillars") {
+                REQUIRE(spawn.type == EntityFactory::EnemyType::Bat);
+            }
+        }
+    }
+}
@@ -11,6 +11,7 @@ TEST_CASE("RunState initial values", "[runstate]") {
     REQUIRE(state.enemiesKilled == 0);
     REQUIRE(state.pickupsCollected == 0);
     REQUIRE(state.visitedRooms.empty());
+    REQUIRE(state.playerEffects.empty());
 }
 
 TEST_CASE("RunState visitRoom increments counter", "[runstate]") {
@@ -49,6 +50,7 @@ TEST_CASE("RunState advanceFloor", "[runstate]") {
 
     REQUIRE(state.currentFloor == 2);
     REQUIRE(state.visitedRooms.empty());
+    REQUIRE(state.playerEffects.empty());
 }
 
 TEST_CASE("RunState reset clears all state", "[runstate]") {
@@ -59,6 +61,7 @@ TEST_CASE("RunState reset clears all state", "[runstate]") {
     state.pickupsCollected = 5;
     state.visitRoom(0);
     state.visitRoom(1);
+    state.playerEffects.push_back(StatusEffect{});
 
     state.reset();
 
@@ -69,4 +72,5 @@ TEST_CASE("RunState reset clears all state", "[runstate]") {
     REQUIRE(state.enemiesKilled == 0);
     REQUIRE(state.pickupsCollected == 0);
     REQUIRE(state.visitedRooms.empty());
+    REQUIRE(state.playerEffects.empty());
 }
@@ -0,0 +1,223 @@
+#include <catch2/catch_all.hpp>
+#include "ecs/Systems.hpp"
+#include "ecs/EntityFactory.hpp"
+#include "game/EntitySnapshot.hpp"
+#include "game/RunState.hpp"
+#include <algorithm>
+
+namespace {
+
+const sf::FloatRect ROOM_BOUNDS({0.f, 0.f}, {800.f, 600.f});
+
+StatusEffect haste(float duration, int maxStacks = 3) {
+    StatusEffect effect;
+    effect.kind = 1;
+    effect.stat = Stat::MoveSpeed;
+    effect.multiply = 1.5f;
+    effect.duration = duration;
+    effect.maxStacks = maxStacks;
+    return effect;
+}
+
+StatusEffect strength(float duration) {
+    StatusEffect effect;
+    effect.kind = 2;
+    effect.stat = Stat::Damage;
+    effect.add = 1.f;
+    effect.duration = duration;
+    effect.maxStacks = 3;
+    return effect;
+}
+
+void advanceSeconds(TimerWheel& wheel, float seconds) {
+    for (int i = 0; i < static_cast<int>(seconds * TimerWheel::TICK_RATE + 0.5f); ++i) {
+        wheel.advance(TimerWheel::TICK);
+    }
+}
+
+} // namespace
+
+// ============================================================================
+// StatusEffectComponent Tests
+// ============================================================================
+
+TEST_CASE("StatusEffectComponent derives stats from stacked effects", "[effects]") {
+    TimerWheel wheel;
+    StatusEffectComponent effects;
+    effects.setBase(Stat::MoveSpeed, 100.f);
+    effects.setBase(Stat::Damage, 1.f);
+
+    effects.apply(haste(5.f), wheel);
+    effects.apply(haste(5.f), wheel);
+    effects.apply(strength(5.f), wheel);
+
+    REQUIRE(effects.stacks(1) == 2);
+    REQUIRE(effects.derived(Stat::MoveSpeed) == Catch::Approx(225.f));  // 100 * 1.5 * 1.5
+    REQUIRE(effects.derived(Stat::Damage) == Catch::Approx(2.f));
+}
+
+TEST_CASE("StatusEffectComponent expires effects in deadline order", "[effects]") {
+    TimerWheel wheel;
+    StatusEffectComponent effects;
+    effects.setBase(Stat::MoveSpeed, 100.f);
+
+    effects.apply(haste(3.f), wheel);
+    effects.apply(haste(1.f), wheel);
+    effects.apply(haste(2.f), wheel);
+    REQUIRE(wheel.pending() == 1);  // One timer for the earliest expiry
+
+    effects.dirty = false;
+    advanceSeconds(wheel, 0.9f);
+    REQUIRE(effects.stacks(1) == 3);
+    REQUIRE_FALSE(effects.dirty);
+
+    advanceSeconds(wheel, 0.2f);
+    REQUIRE(effects.stacks(1) == 2);
+    REQUIRE(effects.dirty);
+
+    advanceSeconds(wheel, 1.f);
+    REQUIRE(effects.stacks(1) == 1);
+    REQUIRE(effects.getActive().front().expiresAt == TimerWheel::toTicks(3.f));
+
+    advanceSeconds(wheel, 1.f);
+    REQUIRE(effects.getActive().empty());
+    REQUIRE(wheel.pending() == 0);
+    REQUIRE(effects.derived(Stat::MoveSpeed) == Catch::Approx(100.f));
+}
+
+TEST_CASE("StatusEffectComponent refreshes the oldest stack past the cap", "[effects]") {
+    TimerWheel wheel;
+    StatusEffectComponent effects;
+    effects.setBase(Stat::MoveSpeed, 100.f);
+
+    effects.apply(haste(1.f, 2), wheel);
+    advanceSeconds(wheel, 0.5f);
+    effects.apply(haste(1.f, 2), wheel);
+    advanceSeconds(wheel, 0.25f);
+    effects.apply(haste(1.f, 2), wheel);  // Replaces the first, which had 0.25s left
+
+    REQUIRE(effects.stacks(1) == 2);
+    advanceSeconds(wheel, 0.5f);
+    REQUIRE(effects.stacks(1) == 2);  // The first would have expired by now
+    advanceSeconds(wheel, 0.3f);
+    REQUIRE(effects.stacks(1) == 1);
+}
+
+TEST_CASE("StatusEffectComponent cancels its timer when destroyed", "[effects]") {
+    TimerWheel wheel;
+    {
+        StatusEffectComponent effects;
+        effects.apply(haste(1.f), wheel);
+        REQUIRE(wheel.pending() == 1);
+    }
+    REQUIRE(wheel.pending() == 0);
+    advanceSeconds(wheel, 2.f);
+}
+
+TEST_CASE("StatusEffectComponent carries effects over with their time left", "[effects]") {
+    TimerWheel wheel;
+    RunState run;
+    std::vector<std::uint64_t> expiries;
+    {
+        StatusEffectComponent effects;
+        effects.apply(haste(3.f), wheel);
+        advanceSeconds(wheel, 1.f);
+        effects.apply(haste(3.f), wheel);
+        effects.apply(strength(0.5f), wheel);
+        advanceSeconds(wheel, 0.25f);
+
+        for (const auto& a : effects.getActive()) expiries.push_back(a.expiresAt);
+        run.playerEffects = effects.carryOver(wheel);
+    }
+    REQUIRE(run.playerEffects.size() == 3);
+    REQUIRE(run.playerEffects.front().duration == Catch::Approx(0.25f));  // Strength goes first
+
+    // A new player in the next room picks up where the old one left off
+    StatusEffectComponent restored;
+    restored.setBase(Stat::MoveSpeed, 100.f);
+    for (const auto& effect : run.playerEffects) restored.apply(effect, wheel);
+
+    std::vector<std::uint64_t> restoredExpiries;
+    for (const auto& a : restored.getActive()) restoredExpiries.push_back(a.expiresAt);
+    std::sort(expiries.begin(), expiries.end());
+    std::sort(restoredExpiries.begin(), restoredExpiries.end());
+    REQUIRE(restoredExpiries == expiries);
+    REQUIRE(restored.derived(Stat::MoveSpeed) == Catch::Approx(225.f));
+
+    advanceSeconds(wheel, 1.8f);  // Past the first haste, 3s after it started
+    REQUIRE(restored.stacks(1) == 1);
+    REQUIRE(restored.stacks(2) == 0);
+}
+
+// ============================================================================
+// StatusEffectSystem Tests
+// ============================================================================
+
+TEST_CASE("StatusEffectSystem writes derived stats only when dirty", "[effects][system]") {
+    TimerWheel clock;
+    EntityManager manager;
+    StatusEffectSystem system;
+    auto& player = EntityFactory::createPlayer(manager, {100.f, 100.f}, ROOM_BOUNDS);
+    auto* physics = player.getComponent<PhysicsComponent>();
+    auto* hitbox = player.getComponent<HitboxComponent>();
+    auto* effects = player.getComponent<StatusEffectComponent>();
+    REQUIRE(effects != nullptr);
+
+    system.update(manager);
+    REQUIRE(physics->speed == Catch::Approx(120.f));
+    REQUIRE(hitbox->damage == 1);
+    REQUIRE_FALSE(effects->dirty);
+
+    effects->apply(haste(1.f), clock);
+    effects->apply(strength(1.f), clock);
+    system.update(manager);
+    REQUIRE(physics->speed == Catch::Approx(180.f));
+    REQUIRE(hitbox->damage == 2);
+
+    // Clean components are left alone
+    physics->speed = 50.f;
+    system.update(manager);
+    REQUIRE(physics->speed == Catch::Approx(50.f));
+
+    advanceSeconds(clock, 1.f);
+    system.update(manager);
+    REQUIRE(physics->speed == Catch::Approx(120.f));
+    REQUIRE(hitbox->damage == 1);
+}
+
+TEST_CASE("PickupSystem applies boost pickups as status effects", "[effects][system][pickup]") {
+    TimerWheel clock;
+    EntityManager manager;
+    PickupSystem pickupSys(clock);
+    StatusEffectSystem effectSys;
+
+    auto& player = EntityFactory::createPlayer(manager, {100.f, 100.f}, ROOM_BOUNDS);
+    auto& speed = EntityFactory::createPickup(manager, PickupType::SpeedBoost, 1, {100.f, 100.f});
+    auto& damage = EntityFactory::createPickup(manager, PickupType::DamageUp, 1, {100.f, 100.f});
+
+    pickupSys.update(manager);
+    effectSys.update(manager);
+
+    REQUIRE(speed.getComponent<PickupComponent>()->collected);
+    REQUIRE(damage.getComponent<PickupComponent>()->collected);
+    REQUIRE(player.getComponent<PhysicsComponent>()->speed == Catch::Approx(150.f));
+    REQUIRE(player.getComponent<HitboxComponent>()->damage == 2);
+    REQUIRE(player.getComponent<HealthComponent>()->current == 3);
+}
+
+TEST_CASE("Boost pickups survive a room snapshot", "[effects][snapshot]") {
+    EntityManager entities;
+    EntityFactory::createPickup(entities, PickupType::DamageUp, 2, {300.f, 300.f});
+
+    EntityManager restored;
+    restoreEntities(restored, captureEntities(entities), ROOM_BOUNDS);
+
+    int found = 0;
+    restored.forEachWith<PickupComponent>([&found](Entity& e) {
+        auto* pickup = e.getComponent<PickupComponent>();
+        REQUIRE(pickup->type == PickupType::DamageUp);
+        REQUIRE(pickup->value == 2);
+        ++found;
+    });
+    REQUIRE(found == 1);
+}
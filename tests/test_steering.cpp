@@ -0,0 +1,141 @@
+#include <catch2/catch_all.hpp>
+#include "ecs/NeighborGrid.hpp"
+#include "ecs/Systems.hpp"
+#include "util/Random.hpp"
+#include <algorithm>
+
+namespace {
+
+Entity& createSteeringAgent(EntityManager& manager, sf::Vector2f position, sf::Vector2f velocity) {
+    auto& entity = manager.createEntity();
+    entity.position = position;
+    entity.addComponent<PhysicsComponent>().velocity = velocity;
+    entity.addComponent<SteeringComponent>();
+    return entity;
+}
+
+} // namespace
+
+// ============================================================================
+// NeighborGrid Tests
+// ============================================================================
+
+TEST_CASE("NeighborGrid finds every point within the cell size", "[steering][grid]") {
+    util::Pcg32 rng(7);
+    std::vector<sf::Vector2f> points;
+    for (int i = 0; i < 500; ++i) {
+        points.push_back({rng.nextFloat(0.f, 800.f), rng.nextFloat(0.f, 600.f)});
+    }
+
+    const float radius = 40.f;
+    NeighborGrid grid;
+    grid.build(points, radius);
+    REQUIRE(grid.size() == points.size());
+
+    for (size_t i = 0; i < points.size(); i += 7) {
+        std::vector<std::uint32_t> found;
+        grid.forEachNear(points[i], [&](std::uint32_t j) {
+            sf::Vector2f d = points[j] - points[i];
+            if (d.x * d.x + d.y * d.y <= radius * radius) found.push_back(j);
+        });
+
+        std::vector<std::uint32_t> expected;
+        for (size_t j = 0; j < points.size(); ++j) {
+            sf::Vector2f d = points[j] - points[i];
+            if (d.x * d.x + d.y * d.y <= radius * radius) expected.push_back(static_cast<std::uint32_t>(j));
+        }
+
+        std::sort(found.begin(), found.end());
+        REQUIRE(found == expected);
+    }
+}
+
+TEST_CASE("NeighborGrid stays small for widely scattered points", "[steering][grid]") {
+    std::vector<sf::Vector2f> points{{0.f, 0.f}, {1e6f, 1e6f}, {5.f, 5.f}};
+    NeighborGrid grid;
+    grid.build(points, 10.f);
+
+    int near = 0;
+    grid.forEachNear({0.f, 0.f}, [&](std::uint32_t j) {
+        sf::Vector2f d = points[j];
+        if (d.x * d.x + d.y * d.y <= 100.f) ++near;
+    });
+    REQUIRE(near == 2);
+}
+
+// ============================================================================
+// SteeringSystem Tests
+// ============================================================================
+
+TEST_CASE("SteeringSystem pushes overlapping agents apart", "[steering]") {
+    EntityManager manager;
+    SteeringSystem steering;
+    auto& left = createSteeringAgent(manager, {100.f, 100.f}, {0.f, 0.f});
+    auto& right = createSteeringAgent(manager, {110.f, 100.f}, {0.f, 0.f});
+
+    steering.update(manager, 0.1f);
+    REQUIRE(left.getComponent<PhysicsComponent>()->velocity.x < 0.f);
+    REQUIRE(right.getComponent<PhysicsComponent>()->velocity.x > 0.f);
+    REQUIRE(left.getComponent<PhysicsComponent>()->velocity.x ==
+            Catch::Approx(-right.getComponent<PhysicsComponent>()->velocity.x));
+}
+
+TEST_CASE("SteeringSystem separates exactly stacked agents", "[steering]") {
+    EntityManager manager;
+    SteeringSystem steering;
+    auto& a = createSteeringAgent(manager, {100.f, 100.f}, {0.f, 0.f});
+    auto& b = createSteeringAgent(manager, {100.f, 100.f}, {0.f, 0.f});
+
+    steering.update(manager, 0.1f);
+    REQUIRE(a.getComponent<PhysicsComponent>()->velocity.x != b.getComponent<PhysicsComponent>()->velocity.x);
+}
+
+TEST_CASE("SteeringSystem leaves distant agents alone", "[steering]") {
+    EntityManager manager;
+    SteeringSystem steering;
+    auto& a = createSteeringAgent(manager, {0.f, 0.f}, {10.f, 0.f});
+    createSteeringAgent(manager, {500.f, 0.f}, {0.f, 10.f});
+
+    steering.update(manager, 0.1f);
+    REQUIRE(a.getComponent<PhysicsComponent>()->velocity.x == 10.f);
+    REQUIRE(a.getComponent<PhysicsComponent>()->velocity.y == 0.f);
+}
+
+TEST_CASE("SteeringSystem aligns a flock's headings", "[steering]") {
+    EntityManager manager;
+    SteeringSystem steering;
+    auto& a = createSteeringAgent(manager, {0.f, 0.f}, {50.f, 0.f});
+    auto& b = createSteeringAgent(manager, {40.f, 0.f}, {0.f, 50.f});
+    for (Entity* e : {&a, &b}) e->getComponent<SteeringComponent>()->alignmentWeight = 2.f;
+
+    steering.update(manager, 0.1f);
+    auto va = a.getComponent<PhysicsComponent>()->velocity;
+    auto vb = b.getComponent<PhysicsComponent>()->velocity;
+    REQUIRE(va.x == Catch::Approx(40.f));
+    REQUIRE(va.y == Catch::Approx(10.f));
+    REQUIRE(vb.x == Catch::Approx(10.f));
+    REQUIRE(vb.y == Catch::Approx(40.f));
+}
+
+TEST_CASE("SteeringSystem draws a flock together", "[steering]") {
+    EntityManager manager;
+    SteeringSystem steering;
+    auto& a = createSteeringAgent(manager, {0.f, 0.f}, {0.f, 0.f});
+    auto& b = createSteeringAgent(manager, {40.f, 0.f}, {0.f, 0.f});
+    for (Entity* e : {&a, &b}) e->getComponent<SteeringComponent>()->cohesionWeight = 1.f;
+
+    steering.update(manager, 0.1f);
+    REQUIRE(a.getComponent<PhysicsComponent>()->velocity.x == Catch::Approx(4.f));
+    REQUIRE(b.getComponent<PhysicsComponent>()->velocity.x == Catch::Approx(-4.f));
+}
+
+TEST_CASE("SteeringSystem caps speed", "[steering]") {
+    EntityManager manager;
+    SteeringSystem steering;
+    auto& a = createSteeringAgent(manager, {100.f, 100.f}, {95.f, 0.f});
+    createSteeringAgent(manager, {95.f, 100.f}, {0.f, 0.f});
+
+    steering.update(manager, 1.f);
+    auto v = a.getComponent<PhysicsComponent>()->velocity;
+    REQUIRE(std::sqrt(v.x * v.x + v.y * v.y) == Catch::Approx(100.f));
+}
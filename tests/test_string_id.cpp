@@ -0,0 +1,52 @@
+#include <catch2/catch_all.hpp>
+#include "core/StringId.hpp"
+#include <thread>
+#include <vector>
+
+TEST_CASE("StringId default is the empty string", "[stringid]") {
+    StringId id;
+
+    REQUIRE(id.empty());
+    REQUIRE(intern("") == id);
+    REQUIRE(StringInterner::instance().str(id).empty());
+}
+
+TEST_CASE("StringInterner returns the same id for equal strings", "[stringid]") {
+    StringId a = intern("test_stringid_slime");
+    StringId b = intern(std::string("test_stringid_") + "slime");
+
+    REQUIRE(a == b);
+    REQUIRE_FALSE(a.empty());
+    REQUIRE(StringInterner::instance().str(a) == "test_stringid_slime");
+}
+
+TEST_CASE("StringInterner gives distinct strings distinct dense ids", "[stringid]") {
+    size_t before = StringInterner::instance().size();
+
+    StringId a = intern("test_stringid_dense_a");
+    StringId b = intern("test_stringid_dense_b");
+
+    REQUIRE(a != b);
+    REQUIRE(b.value == a.value + 1);
+    REQUIRE(StringInterner::instance().size() == before + 2);
+}
+
+TEST_CASE("StringInterner is safe to use from several threads", "[stringid]") {
+    std::vector<std::thread> threads;
+    std::vector<StringId> results(8);
+
+    for (size_t t = 0; t < results.size(); ++t) {
+        threads.emplace_back([&results, t]() {
+            for (int i = 0; i < 100; ++i) {
+                intern("test_stringid_thread_" + std::to_string(i));
+            }
+            results[t] = intern("test_stringid_shared");
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    for (const auto& id : results) {
+        REQUIRE(id == results[0]);
+    }
+    REQUIRE(StringInterner::instance().str(results[0]) == "test_stringid_shared");
+}
@@ -0,0 +1,101 @@
+#include <catch2/catch_all.hpp>
+#include "util/Sweep.hpp"
+#include "ecs/Systems.hpp"
+#include "game/Room.hpp"
+
+// ============================================================================
+// Swept AABB Tests
+// ============================================================================
+
+TEST_CASE("sweepAabb finds the time of first contact", "[sweep]") {
+    sf::FloatRect moving({0.f, 0.f}, {10.f, 10.f});
+    sf::FloatRect target({50.f, 0.f}, {10.f, 10.f});
+
+    auto hit = util::sweepAabb(moving, {80.f, 0.f}, target);
+    REQUIRE(hit.has_value());
+    REQUIRE(*hit == Catch::Approx(0.5f));  // Edges meet after 40 of 80
+}
+
+TEST_CASE("sweepAabb misses targets off the path or out of reach", "[sweep]") {
+    sf::FloatRect moving({0.f, 0.f}, {10.f, 10.f});
+
+    REQUIRE_FALSE(util::sweepAabb(moving, {80.f, 0.f}, sf::FloatRect({50.f, 20.f}, {10.f, 10.f})));
+    REQUIRE_FALSE(util::sweepAabb(moving, {30.f, 0.f}, sf::FloatRect({50.f, 0.f}, {10.f, 10.f})));
+    REQUIRE_FALSE(util::sweepAabb(moving, {-80.f, 0.f}, sf::FloatRect({50.f, 0.f}, {10.f, 10.f})));
+    // Sliding along an edge is touching, not overlapping
+    REQUIRE_FALSE(util::sweepAabb(moving, {80.f, 0.f}, sf::FloatRect({50.f, 10.f}, {10.f, 10.f})));
+}
+
+TEST_CASE("sweepAabb reports boxes that start overlapped at time zero", "[sweep]") {
+    sf::FloatRect moving({0.f, 0.f}, {10.f, 10.f});
+    auto hit = util::sweepAabb(moving, {0.f, 0.f}, sf::FloatRect({5.f, 5.f}, {10.f, 10.f}));
+    REQUIRE(hit.has_value());
+    REQUIRE(*hit == 0.f);
+}
+
+TEST_CASE("sweepAabb handles diagonal movement", "[sweep]") {
+    sf::FloatRect moving({0.f, 0.f}, {10.f, 10.f});
+    sf::FloatRect target({40.f, 40.f}, {10.f, 10.f});
+
+    REQUIRE(util::sweepAabb(moving, {100.f, 100.f}, target).has_value());
+    // Passes beside the target's corner without touching it
+    REQUIRE_FALSE(util::sweepAabb(moving, {100.f, 20.f}, target).has_value());
+}
+
+TEST_CASE("overlapsDuringStep only sweeps fast relative motion", "[sweep]") {
+    sf::FloatRect a({100.f, 0.f}, {10.f, 10.f});
+    sf::FloatRect b({50.f, 0.f}, {10.f, 10.f});
+
+    // Slow: end-of-step overlap decides
+    REQUIRE_FALSE(util::overlapsDuringStep(a, {2.f, 0.f}, b, {0.f, 0.f}));
+    // Fast: a passed straight through b during the step
+    REQUIRE(util::overlapsDuringStep(a, {100.f, 0.f}, b, {0.f, 0.f}));
+    // Both moving the same way leaves no relative motion
+    REQUIRE_FALSE(util::overlapsDuringStep(a, {100.f, 0.f}, b, {100.f, 0.f}));
+}
+
+TEST_CASE("CollisionSystem hits a target a fast hitbox passed through", "[sweep][collision]") {
+    TimerWheel clock;
+    EntityManager manager;
+    CollisionSystem collision(clock);
+    EventBus::instance().clear();
+
+    auto& attacker = manager.createEntity();
+    attacker.position = {400.f, 100.f};
+    auto& hitbox = attacker.addComponent<HitboxComponent>();
+    hitbox.size = {20.f, 20.f};
+    hitbox.faction = Faction::Player;
+    hitbox.active = true;
+    hitbox.facing = {1.f, 0.f};
+    auto& physics = attacker.addComponent<PhysicsComponent>();
+    physics.lastMove = {300.f, 0.f};  // Came from x = 100 in one step
+
+    auto& target = manager.createEntity();
+    target.position = {250.f, 100.f};
+    target.addComponent<HurtboxComponent>(sf::Vector2f{32.f, 32.f});
+    target.addComponent<HealthComponent>(3, 0.f);
+    target.addComponent<EnemyTag>();
+
+    collision.update(manager);
+    REQUIRE(target.getComponent<HealthComponent>()->current == 2);
+
+    // Without the step it was a clean miss
+    physics.lastMove = {0.f, 0.f};
+    collision.update(manager);
+    REQUIRE(target.getComponent<HealthComponent>()->current == 2);
+}
+
+TEST_CASE("Room door triggers when the player crosses it in one step", "[sweep][room]") {
+    Room room(0, RoomType::Start, {800.f, 600.f});
+    room.connectDoor(Direction::North, 1);
+    EntityManager manager;
+    room.update(manager);  // Start rooms unlock their doors
+
+    // End position is past the north doorway
+    sf::Vector2f end{600.f, 50.f};
+    REQUIRE(room.checkDoorCollision(end, {32.f, 32.f}) == nullptr);
+
+    Door* door = room.checkDoorCollision(end, {32.f, 32.f}, {400.f, 0.f});
+    REQUIRE(door != nullptr);
+    REQUIRE(door->direction == Direction::North);
+}
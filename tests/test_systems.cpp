@@ -106,53 +106,65 @@ TEST_CASE("PhysicsSystem skips entities without PhysicsComponent", "[system][phy
 }
 
 // ============================================================================
-// HealthSystem Tests
+// Gameplay Timer Tests
 // ============================================================================
 
-TEST_CASE("HealthSystem updates invincibility timers", "[system][health]") {
+TEST_CASE("Game clock expires invincibility", "[system][health]") {
+    TimerWheel clock;
     EntityManager manager;
-    HealthSystem healthSys;
 
     auto& entity = manager.createEntity();
     auto& health = entity.addComponent<HealthComponent>(3, 1.0f);
-    health.takeDamage(1);
+    health.takeDamage(1, clock);
 
     REQUIRE(health.isInvincible());
-    REQUIRE(health.invincibilityTimer == Catch::Approx(1.0f));
+    REQUIRE(health.invincibility.remaining() == Catch::Approx(1.0f));
 
-    healthSys.update(manager, 0.5f);
-    REQUIRE(health.invincibilityTimer == Catch::Approx(0.5f));
+    clock.advance(0.5f);
+    REQUIRE(health.invincibility.remaining() == Catch::Approx(0.5f));
     REQUIRE(health.isInvincible());
 
-    healthSys.update(manager, 0.6f);
+    clock.advance(0.6f);
     REQUIRE_FALSE(health.isInvincible());
 }
 
-TEST_CASE("HealthSystem updates multiple entities", "[system][health]") {
+TEST_CASE("Game clock expires invincibility per entity", "[system][health]") {
+    TimerWheel clock;
     EntityManager manager;
-    HealthSystem healthSys;
 
     auto& e1 = manager.createEntity();
     auto& h1 = e1.addComponent<HealthComponent>(3, 1.0f);
-    h1.takeDamage(1);
+    h1.takeDamage(1, clock);
 
     auto& e2 = manager.createEntity();
     auto& h2 = e2.addComponent<HealthComponent>(3, 0.5f);
-    h2.takeDamage(1);
+    h2.takeDamage(1, clock);
 
-    healthSys.update(manager, 0.6f);
+    clock.advance(0.6f);
 
-    REQUIRE(h1.isInvincible());      // 1.0 - 0.6 = 0.4 > 0
+    REQUIRE(h1.isInvincible());       // 1.0 - 0.6 = 0.4 > 0
     REQUIRE_FALSE(h2.isInvincible()); // 0.5 - 0.6 < 0
 }
 
+TEST_CASE("Destroying an entity cancels its timers", "[system][health]") {
+    TimerWheel clock;
+    {
+        EntityManager manager;
+        auto& entity = manager.createEntity();
+        entity.addComponent<HealthComponent>(3, 1.0f).takeDamage(1, clock);
+        REQUIRE(clock.pending() == 1);
+    }
+    REQUIRE(clock.pending() == 0);
+}
+
 // ============================================================================
 // CollisionSystem Tests
 // ============================================================================
 
 TEST_CASE("CollisionSystem hitbox-hurtbox collision", "[system][collision]") {
+    TimerWheel clock;
     EntityManager manager;
-    CollisionSystem collision;
+    CollisionSystem collision(clock);
     EventBus::instance().clear();
 
     // Create attacker with active hitbox
@@ -179,8 +191,9 @@ TEST_CASE("CollisionSystem hitbox-hurtbox collision", "[system][collision]") {
 }
 
 TEST_CASE("CollisionSystem inactive hitbox does nothing", "[system][collision]") {
+    TimerWheel clock;
     EntityManager manager;
-    CollisionSystem collision;
+    CollisionSystem collision(clock);
     EventBus::instance().clear();
 
     auto& attacker = manager.createEntity();
@@ -200,8 +213,9 @@ TEST_CASE("CollisionSystem inactive hitbox does nothing", "[system][collision]")
 }
 
 TEST_CASE("CollisionSystem same faction immunity", "[system][collision]") {
+    TimerWheel clock;
     EntityManager manager;
-    CollisionSystem collision;
+    CollisionSystem collision(clock);
     EventBus::instance().clear();
 
     // Two player-faction entities
@@ -225,8 +239,9 @@ TEST_CASE("CollisionSystem same faction immunity", "[system][collision]") {
 }
 
 TEST_CASE("CollisionSystem invincible target not damaged", "[system][collision]") {
+    TimerWheel clock;
     EntityManager manager;
-    CollisionSystem collision;
+    CollisionSystem collision(clock);
     EventBus::instance().clear();
 
     auto& attacker = manager.createEntity();
@@ -240,7 +255,7 @@ TEST_CASE("CollisionSystem invincible target not damaged", "[system][collision]"
     target.position = {120.f, 100.f};
     target.addComponent<HurtboxComponent>(sf::Vector2f{32.f, 32.f});
     auto& health = target.addComponent<HealthComponent>(3, 1.0f);
-    health.takeDamage(1);  // Makes target invincible
+    health.takeDamage(1, clock);  // Makes target invincible
 
     REQUIRE(health.current == 2);
     REQUIRE(health.isInvincible());
@@ -255,8 +270,9 @@ TEST_CASE("CollisionSystem invincible target not damaged", "[system][collision]"
 // ============================================================================
 
 TEST_CASE("PickupSystem health collection", "[system][pickup]") {
+    TimerWheel clock;
     EntityManager manager;
-    PickupSystem pickupSys;
+    PickupSystem pickupSys(clock);
     EventBus::instance().clear();
 
     // Create player at low health
@@ -275,8 +291,9 @@ TEST_CASE("PickupSystem health collection", "[system][pickup]") {
 }
 
 TEST_CASE("PickupSystem health capped at max", "[system][pickup]") {
+    TimerWheel clock;
     EntityManager manager;
-    PickupSystem pickupSys;
+    PickupSystem pickupSys(clock);
     EventBus::instance().clear();
 
     sf::FloatRect bounds({0.f, 0.f}, {800.f, 600.f});
@@ -292,8 +309,9 @@ TEST_CASE("PickupSystem health capped at max", "[system][pickup]") {
 }
 
 TEST_CASE("PickupSystem no collection without player", "[system][pickup]") {
+    TimerWheel clock;
     EntityManager manager;
-    PickupSystem pickupSys;
+    PickupSystem pickupSys(clock);
     EventBus::instance().clear();
 
     // Only pickup, no player
@@ -306,8 +324,9 @@ TEST_CASE("PickupSystem no collection without player", "[system][pickup]") {
 }
 
 TEST_CASE("PickupSystem emits event on collection", "[system][pickup]") {
+    TimerWheel clock;
     EntityManager manager;
-    PickupSystem pickupSys;
+    PickupSystem pickupSys(clock);
     EventBus::instance().clear();
 
     bool eventReceived = false;
@@ -327,3 +346,118 @@ TEST_CASE("PickupSystem emits event on collection", "[system][pickup]") {
     REQUIRE(eventReceived);
     REQUIRE(receivedValue == 1);
 }
+
+// ============================================================================
+// AISystem Tests
+// ============================================================================
+
+namespace {
+
+Entity& createAgent(EntityManager& manager, sf::Vector2f position) {
+    auto& entity = manager.createEntity();
+    entity.position = position;
+    entity.addComponent<AIComponent>(AIBehavior::Wander, 150.f, 40.f, 80.f);
+    entity.addComponent<PhysicsComponent>();
+    return entity;
+}
+
+} // namespace
+
+TEST_CASE("AISystem chasers near the player decide every tick", "[system][ai]") {
+    EntityManager manager;
+    AISystem ai;
+    auto& chaser = createAgent(manager, {100.f, 0.f});
+
+    ai.update(manager, 0.016f, {0.f, 0.f});
+    REQUIRE(chaser.getComponent<AIComponent>()->isChasing);
+    REQUIRE(chaser.getComponent<AIComponent>()->lod == AILod::Full);
+    REQUIRE(chaser.getComponent<PhysicsComponent>()->velocity.x < 0.f);
+
+    // Player moves to the other side: the chaser turns on the very next tick
+    ai.update(manager, 0.016f, {200.f, 0.f});
+    REQUIRE(ai.getStats().decisions == 1);
+    REQUIRE(chaser.getComponent<PhysicsComponent>()->velocity.x > 0.f);
+}
+
+TEST_CASE("AISystem far agents decide at a reduced rate", "[system][ai]") {
+    EntityManager manager;
+    AISystem ai;
+    auto& half = createAgent(manager, {500.f, 0.f});
+    auto& quarter = createAgent(manager, {2000.f, 0.f});
+
+    ai.update(manager, 0.016f, {0.f, 0.f});
+    REQUIRE(half.getComponent<AIComponent>()->lod == AILod::Half);
+    REQUIRE(quarter.getComponent<AIComponent>()->lod == AILod::Quarter);
+
+    size_t decisions = 0;
+    for (int i = 0; i < 4; ++i) {
+        ai.update(manager, 0.016f, {0.f, 0.f});
+        decisions += ai.getStats().decisions;
+    }
+    REQUIRE(decisions == 3);  // Two half-rate, one quarter-rate
+}
+
+TEST_CASE("AISystem spreads decisions of a horde across ticks", "[system][ai]") {
+    EntityManager manager;
+    AISystem ai;
+    for (int i = 0; i < 40; ++i) {
+        createAgent(manager, {2000.f + i, 0.f});
+    }
+
+    ai.update(manager, 0.016f, {0.f, 0.f});
+    REQUIRE(ai.getStats().decisions == 40);
+
+    for (int i = 0; i < 4; ++i) {
+        ai.update(manager, 0.016f, {0.f, 0.f});
+        REQUIRE(ai.getStats().agents == 40);
+        REQUIRE(ai.getStats().decisions == 10);
+    }
+}
+
+TEST_CASE("AISystem defers reduced-rate agents past the time budget", "[system][ai]") {
+    EntityManager manager;
+    AISystem ai;
+    auto& nearby = createAgent(manager, {100.f, 0.f});
+    auto& far = createAgent(manager, {500.f, 0.f});
+
+    ai.update(manager, 0.016f, {0.f, 0.f});
+    ai.setTimeBudget(std::chrono::microseconds{0});
+
+    // Within two ticks the half-rate agent comes due and is deferred
+    ai.update(manager, 0.016f, {0.f, 0.f});
+    ai.update(manager, 0.016f, {0.f, 0.f});
+    REQUIRE(far.getComponent<AIComponent>()->overdue);
+    REQUIRE(ai.getStats().decisions == 1);  // The nearby chaser still decided
+    REQUIRE(nearby.getComponent<AIComponent>()->lod == AILod::Full);
+
+    ai.setTimeBudget(AISystem::DEFAULT_BUDGET);
+    ai.update(manager, 0.016f, {0.f, 0.f});
+    REQUIRE_FALSE(far.getComponent<AIComponent>()->overdue);
+    REQUIRE(far.getComponent<AIComponent>()->sinceDecision == 0.f);
+}
+
+TEST_CASE("AISystem bounds how long an agent stays deferred", "[system][ai]") {
+    EntityManager manager;
+    AISystem ai;
+    const int agents = 400;
+    for (int i = 0; i < agents; ++i) {
+        createAgent(manager, {2000.f + i, 0.f});
+    }
+
+    // A budget far below a tenth of the horde per tick keeps it overloaded
+    ai.update(manager, 0.016f, {0.f, 0.f});
+    ai.setTimeBudget(std::chrono::microseconds{1});
+
+    float longestWait = 0.f;
+    for (int tick = 0; tick < 2 * agents; ++tick) {
+        ai.update(manager, 0.016f, {0.f, 0.f});
+        manager.forEachWith<AIComponent>([&longestWait](Entity& e) {
+            longestWait = std::max(longestWait, e.getComponent<AIComponent>()->sinceDecision);
+        });
+    }
+
+    // Longest-waiting first: nobody waits longer than it takes to serve the
+    // whole horde one decision per tick, plus one quarter-rate interval
+    REQUIRE(ai.getStats().deferred > 0);
+    REQUIRE(longestWait <= (agents + 4) * 0.016f + 0.001f);
+}
@@ -0,0 +1,163 @@
+#include <catch2/catch_all.hpp>
+#include "core/TimerWheel.hpp"
+#include <vector>
+
+// ============================================================================
+// TimerWheel Tests
+// ============================================================================
+
+TEST_CASE("TimerWheel fires timers in deadline order", "[timer]") {
+    TimerWheel wheel;
+    std::vector<int> fired;
+
+    wheel.schedule(0.3f, [&]() { fired.push_back(3); });
+    wheel.schedule(0.1f, [&]() { fired.push_back(1); });
+    wheel.schedule(0.2f, [&]() { fired.push_back(2); });
+    REQUIRE(wheel.pending() == 3);
+
+    wheel.advance(0.15f);
+    REQUIRE(fired == std::vector<int>{1});
+
+    wheel.advance(0.2f);
+    REQUIRE(fired == std::vector<int>{1, 2, 3});
+    REQUIRE(wheel.pending() == 0);
+}
+
+TEST_CASE("TimerWheel never fires early", "[timer]") {
+    TimerWheel wheel;
+    bool fired = false;
+
+    wheel.schedule(0.5f, [&]() { fired = true; });
+    for (int i = 0; i < TimerWheel::TICK_RATE / 2 - 1; ++i) wheel.advance(TimerWheel::TICK);
+    REQUIRE_FALSE(fired);
+
+    wheel.advance(TimerWheel::TICK);
+    REQUIRE(fired);
+}
+
+TEST_CASE("TimerWheel cascades long timers down the levels", "[timer]") {
+    TimerWheel wheel;
+    std::vector<float> firedAt;
+    float elapsed = 0.f;
+
+    // Level 0, level 1 and level 2 deadlines
+    for (float seconds : {0.25f, 20.f, 300.f}) {
+        wheel.schedule(seconds, [&firedAt, &elapsed]() { firedAt.push_back(elapsed); });
+    }
+
+    for (int i = 0; i < 400 * TimerWheel::TICK_RATE; ++i) {
+        wheel.advance(TimerWheel::TICK);
+        elapsed += TimerWheel::TICK;
+    }
+
+    REQUIRE(firedAt.size() == 3);
+    REQUIRE(firedAt[0] == Catch::Approx(0.25f).margin(0.02f));
+    REQUIRE(firedAt[1] == Catch::Approx(20.f).margin(0.1f));
+    REQUIRE(firedAt[2] == Catch::Approx(300.f).margin(0.5f));
+}
+
+TEST_CASE("TimerWheel cancel stops a timer firing", "[timer]") {
+    TimerWheel wheel;
+    int fired = 0;
+
+    auto handle = wheel.schedule(0.2f, [&]() { ++fired; });
+    wheel.schedule(0.2f, [&]() { fired += 10; });
+
+    REQUIRE(wheel.cancel(handle));
+    REQUIRE_FALSE(wheel.isPending(handle));
+    REQUIRE_FALSE(wheel.cancel(handle));
+
+    wheel.advance(1.f);
+    REQUIRE(fired == 10);
+}
+
+TEST_CASE("TimerWheel handles go stale once fired", "[timer]") {
+    TimerWheel wheel;
+
+    auto first = wheel.schedule(0.1f);
+    wheel.advance(0.2f);
+    REQUIRE_FALSE(wheel.isPending(first));
+
+    // The freed slot is reused, but the old handle must not see the new timer
+    auto second = wheel.schedule(0.1f);
+    REQUIRE(second.index == first.index);
+    REQUIRE(wheel.isPending(second));
+    REQUIRE_FALSE(wheel.isPending(first));
+    REQUIRE_FALSE(wheel.cancel(first));
+    REQUIRE(wheel.isPending(second));
+}
+
+TEST_CASE("TimerWheel reports remaining time", "[timer]") {
+    TimerWheel wheel;
+
+    auto handle = wheel.schedule(1.f);
+    REQUIRE(wheel.remaining(handle) == Catch::Approx(1.f).margin(TimerWheel::TICK));
+
+    wheel.advance(0.4f);
+    REQUIRE(wheel.remaining(handle) == Catch::Approx(0.6f).margin(TimerWheel::TICK));
+
+    wheel.advance(1.f);
+    REQUIRE(wheel.remaining(handle) == 0.f);
+}
+
+TEST_CASE("TimerWheel callbacks can schedule more timers", "[timer]") {
+    TimerWheel wheel;
+    int fired = 0;
+
+    std::function<void()> repeat = [&]() {
+        if (++fired < 5) wheel.schedule(0.1f, repeat);
+    };
+    wheel.schedule(0.1f, repeat);
+
+    wheel.advance(0.35f);
+    REQUIRE(fired == 3);
+
+    wheel.advance(1.f);
+    REQUIRE(fired == 5);
+    REQUIRE(wheel.pending() == 0);
+}
+
+TEST_CASE("TimerWheel clear drops pending timers", "[timer]") {
+    TimerWheel wheel;
+    bool fired = false;
+
+    auto handle = wheel.schedule(0.1f, [&]() { fired = true; });
+    wheel.schedule(100.f, [&]() { fired = true; });
+    wheel.clear();
+
+    REQUIRE(wheel.pending() == 0);
+    REQUIRE_FALSE(wheel.isPending(handle));
+    wheel.advance(200.f);
+    REQUIRE_FALSE(fired);
+}
+
+// ============================================================================
+// Timer Tests
+// ============================================================================
+
+TEST_CASE("Timer restarts and cancels on destruction", "[timer]") {
+    TimerWheel wheel;
+    int fired = 0;
+
+    {
+        Timer timer;
+        timer.start(wheel, 0.2f, [&]() { ++fired; });
+        wheel.advance(0.1f);
+
+        timer.start(wheel, 0.2f, [&]() { ++fired; });  // Restarting replaces the first
+        REQUIRE(wheel.pending() == 1);
+        wheel.advance(0.15f);
+        REQUIRE(fired == 0);
+        REQUIRE(timer.isPending());
+
+        wheel.advance(0.1f);
+        REQUIRE(fired == 1);
+        REQUIRE_FALSE(timer.isPending());
+
+        timer.start(wheel, 1.f, [&]() { ++fired; });
+    }
+
+    REQUIRE(wheel.pending() == 0);
+    wheel.advance(2.f);
+    REQUIRE(fired == 1);
+}
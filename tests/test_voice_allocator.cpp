@@ -0,0 +1,89 @@
+#include <catch2/catch_all.hpp>
+#include "audio/VoiceAllocator.hpp"
+
+// ============================================================================
+// VoiceAllocator Tests
+// ============================================================================
+
+TEST_CASE("VoiceAllocator uses free voices first", "[audio]") {
+    VoiceAllocator allocator(3);
+
+    REQUIRE(allocator.allocate(1, 0, 0) == 0);
+    REQUIRE(allocator.allocate(2, 0, 0) == 1);
+    REQUIRE(allocator.allocate(3, 0, 0) == 2);
+    REQUIRE(allocator.activeCount() == 3);
+    REQUIRE(allocator.getStolenCount() == 0);
+}
+
+TEST_CASE("VoiceAllocator caps concurrent instances of a sound", "[audio]") {
+    VoiceAllocator allocator(8);
+
+    int first = allocator.allocate(1, 0, 2);
+    int second = allocator.allocate(1, 0, 2);
+    int third = allocator.allocate(1, 0, 2);
+
+    // The third instance restarts the oldest one instead of taking a new voice
+    REQUIRE(third == first);
+    REQUIRE(second != first);
+    REQUIRE(allocator.activeCount() == 2);
+
+    // The restarted voice is now the newest, so the next restart takes the other
+    REQUIRE(allocator.allocate(1, 0, 2) == second);
+}
+
+TEST_CASE("VoiceAllocator steals the oldest lowest-priority voice", "[audio]") {
+    VoiceAllocator allocator(3);
+
+    allocator.allocate(1, 2, 0);          // Voice 0, high priority
+    allocator.allocate(2, 0, 0);          // Voice 1, low priority, oldest low
+    allocator.allocate(3, 0, 0);          // Voice 2, low priority
+
+    REQUIRE(allocator.allocate(4, 1, 0) == 1);
+    REQUIRE(allocator.getVoices()[1].sound == 4);
+    REQUIRE(allocator.getStolenCount() == 1);
+
+    // Voice 2 is now the only one at priority 0
+    REQUIRE(allocator.allocate(5, 1, 0) == 2);
+}
+
+TEST_CASE("VoiceAllocator drops sounds below every playing voice", "[audio]") {
+    VoiceAllocator allocator(2);
+
+    allocator.allocate(1, 3, 0);
+    allocator.allocate(2, 3, 0);
+
+    REQUIRE(allocator.allocate(3, 1, 0) == -1);
+    REQUIRE(allocator.getVoices()[0].sound == 1);
+    REQUIRE(allocator.getVoices()[1].sound == 2);
+}
+
+TEST_CASE("VoiceAllocator reuses released voices", "[audio]") {
+    VoiceAllocator allocator(2);
+
+    allocator.allocate(1, 3, 0);
+    allocator.allocate(2, 3, 0);
+    allocator.release(0);
+
+    REQUIRE(allocator.activeCount() == 1);
+    REQUIRE(allocator.allocate(3, 0, 0) == 0);
+    REQUIRE(allocator.getStolenCount() == 0);
+}
+
+TEST_CASE("VoiceAllocator handles a burst larger than the pool", "[audio]") {
+    VoiceAllocator allocator(16);
+
+    int played = 0;
+    for (int i = 0; i < 500; ++i) {
+        if (allocator.allocate(static_cast<std::uint32_t>(i % 5), i % 3, 4) >= 0) ++played;
+    }
+
+    REQUIRE(allocator.activeCount() <= 16);
+    REQUIRE(played > 16);
+    for (std::uint32_t sound = 0; sound < 5; ++sound) {
+        int count = 0;
+        for (const auto& voice : allocator.getVoices()) {
+            if (voice.active && voice.sound == sound) ++count;
+        }
+        REQUIRE(count <= 4);
+    }
+}
@@ -0,0 +1,104 @@
+// Offline asset packer.
+//
+// Reads an asset manifest, decodes every texture and sound with SFML, copies
+// fonts and music as-is and writes a single .pak file the game can mount at
+// startup:
+//
+//   AssetPacker assets/manifest.txt assets/assets.pak
+
+#include "core/AssetManifest.hpp"
+#include "core/AssetPack.hpp"
+#include <SFML/Graphics.hpp>
+#include <SFML/Audio.hpp>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+namespace {
+
+bool packTexture(AssetPackWriter& writer, const AssetManifestEntry& entry) {
+    sf::Image image;
+    if (!image.loadFromFile(entry.path)) {
+        std::cerr << "Failed to decode texture: " << entry.path << "\n";
+        return false;
+    }
+    writer.addTexture(entry.id, image.getSize().x, image.getSize().y, image.getPixelsPtr());
+    return true;
+}
+
+bool packSound(AssetPackWriter& writer, const AssetManifestEntry& entry) {
+    sf::SoundBuffer buffer;
+    if (!buffer.loadFromFile(entry.path)) {
+        std::cerr << "Failed to decode sound: " << entry.path << "\n";
+        return false;
+    }
+    std::vector<std::uint8_t> channelMap;
+    for (sf::SoundChannel channel : buffer.getChannelMap()) {
+        channelMap.push_back(static_cast<std::uint8_t>(channel));
+    }
+    writer.addSound(entry.id, buffer.getSamples(), buffer.getSampleCount(),
+                    buffer.getChannelCount(), buffer.getSampleRate(), channelMap);
+    return true;
+}
+
+bool readFile(const std::string& path, std::vector<std::uint8_t>& bytes) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return true;
+}
+
+bool packFont(AssetPackWriter& writer, const AssetManifestEntry& entry) {
+    std::vector<std::uint8_t> bytes;
+    if (!readFile(entry.path, bytes)) {
+        std::cerr << "Failed to read font: " << entry.path << "\n";
+        return false;
+    }
+    writer.addFont(entry.id, bytes.data(), bytes.size());
+    return true;
+}
+
+// Music stays compressed; the game streams it out of the pack
+bool packMusic(AssetPackWriter& writer, const AssetManifestEntry& entry) {
+    std::vector<std::uint8_t> bytes;
+    if (!readFile(entry.path, bytes)) {
+        std::cerr << "Failed to read music: " << entry.path << "\n";
+        return false;
+    }
+    writer.addMusic(entry.id, bytes.data(), bytes.size());
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " <manifest> <output.pak>\n";
+        return 1;
+    }
+
+    AssetManifest manifest;
+    if (!manifest.loadFromFile(argv[1])) {
+        return 1;
+    }
+
+    AssetPackWriter writer;
+    bool ok = true;
+    for (const auto& entry : manifest.getEntries()) {
+        switch (entry.kind) {
+            case AssetKind::Texture: ok = packTexture(writer, entry) && ok; break;
+            case AssetKind::Sound:   ok = packSound(writer, entry) && ok; break;
+            case AssetKind::Font:    ok = packFont(writer, entry) && ok; break;
+            case AssetKind::Music:   ok = packMusic(writer, entry) && ok; break;
+        }
+    }
+
+    if (!ok || !writer.write(argv[2])) {
+        return 1;
+    }
+
+    std::cout << "Packed " << writer.count() << " assets into " << argv[2] << "\n";
+    return 0;
+}
@@ -0,0 +1,324 @@
+// Seed search and floor-property index.
+//
+// Generates the floor a run seed produces, records its layout metrics and
+// writes them to a compact sorted index that can be queried later:
+//
+//   SeedSearch build <index> <floor> <firstSeed> <count> [threads]
+//   SeedSearch query <index> [--rooms a:b] [--depth a:b] [--dead-ends a:b]
+//                            [--branches a:b] [--limit n]
+//
+// Seeds are run seeds, as printed by the game and accepted by DUNGEON_SEED,
+// so a match can be played directly. Any number of seeds fits in one index:
+// ranges too big for memory are sorted in chunks on disk and merged.
+
+#include "game/FloorMetrics.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <queue>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+const char INDEX_MAGIC[8] = {'D', 'C', 'S', 'E', 'E', 'D', 'S', '1'};
+
+constexpr std::uint64_t CHUNK_RECORDS = std::uint64_t{1} << 24;  // 256 MB of records in memory
+constexpr size_t MERGE_BLOCK = 1 << 14;                          // Records buffered per run
+constexpr size_t QUERY_BLOCK = 1 << 14;
+constexpr int MAX_FLOOR = 0xFFFF - 4;  // Room counts (4 + floor) are stored in 16 bits
+
+struct IndexHeader {
+    char magic[8];
+    std::uint32_t floorNumber;
+    std::uint32_t reserved;
+    std::uint64_t recordCount;
+};
+
+void usage(const char* program) {
+    std::cerr << "Usage:\n"
+              << "  " << program << " build <index> <floor> <firstSeed> <count> [threads]\n"
+              << "  " << program << " query <index> [--rooms a:b] [--depth a:b] [--dead-ends a:b]"
+              << " [--branches a:b] [--limit n]\n";
+}
+
+FloorMetrics measure(int floorNumber, std::uint64_t runSeed) {
+    // Same derivation and room count as PlayingState
+    std::uint64_t seed = util::deriveSeed(runSeed, static_cast<std::uint64_t>(floorNumber));
+    Floor floor(floorNumber, {800.f, 600.f}, Floor::defaultRoomCount(floorNumber), seed);
+    return computeFloorMetrics(floor);
+}
+
+// Measures firstSeed .. firstSeed + records.size() - 1, interleaved so every
+// thread gets a similar mix of floor sizes
+void measureRange(std::vector<SeedIndexRecord>& records, int floorNumber, std::uint64_t firstSeed,
+                  unsigned threadCount) {
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < threadCount; ++t) {
+        workers.emplace_back([&, t]() {
+            for (std::uint64_t i = t; i < records.size(); i += threadCount) {
+                records[i] = {firstSeed + i, measure(floorNumber, firstSeed + i)};
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+bool writeRecords(std::ofstream& file, const SeedIndexRecord* records, size_t count) {
+    return static_cast<bool>(file.write(reinterpret_cast<const char*>(records),
+                                        static_cast<std::streamsize>(count * sizeof(SeedIndexRecord))));
+}
+
+// Sequential reader over one sorted run, a block at a time
+class RunReader {
+public:
+    explicit RunReader(const std::string& path) : file(path, std::ios::binary), buffer(MERGE_BLOCK) {}
+
+    bool next(SeedIndexRecord& record) {
+        if (position == filled) {
+            file.read(reinterpret_cast<char*>(buffer.data()),
+                      static_cast<std::streamsize>(buffer.size() * sizeof(SeedIndexRecord)));
+            filled = static_cast<size_t>(file.gcount()) / sizeof(SeedIndexRecord);
+            position = 0;
+            if (filled == 0) return false;
+        }
+        record = buffer[position++];
+        return true;
+    }
+
+private:
+    std::ifstream file;
+    std::vector<SeedIndexRecord> buffer;
+    size_t position = 0;
+    size_t filled = 0;
+};
+
+// Merges sorted run files into the records section of file
+bool mergeRuns(const std::vector<std::string>& runs, std::ofstream& file) {
+    std::vector<std::unique_ptr<RunReader>> readers;
+    using Head = std::pair<SeedIndexRecord, size_t>;  // Next record and the run it came from
+    auto later = [](const Head& a, const Head& b) { return b.first < a.first; };
+    std::priority_queue<Head, std::vector<Head>, decltype(later)> heads(later);
+
+    for (size_t r = 0; r < runs.size(); ++r) {
+        readers.push_back(std::make_unique<RunReader>(runs[r]));
+        SeedIndexRecord record;
+        if (readers[r]->next(record)) heads.push({record, r});
+    }
+
+    std::vector<SeedIndexRecord> out;
+    out.reserve(MERGE_BLOCK);
+    while (!heads.empty()) {
+        auto [record, r] = heads.top();
+        heads.pop();
+        out.push_back(record);
+        if (out.size() == MERGE_BLOCK) {
+            if (!writeRecords(file, out.data(), out.size())) return false;
+            out.clear();
+        }
+        if (readers[r]->next(record)) heads.push({record, r});
+    }
+    return writeRecords(file, out.data(), out.size());
+}
+
+// Seeds are measured and sorted CHUNK_RECORDS at a time. A range larger than
+// one chunk is spilled to sorted run files next to the index and merged, so
+// memory stays bounded however many seeds are indexed.
+int build(const std::string& path, int floorNumber, std::uint64_t firstSeed, std::uint64_t count,
+          unsigned threadCount) {
+    std::ofstream file(path, std::ios::binary);
+    if (!file) {
+        std::cerr << "Failed to open index for writing: " << path << "\n";
+        return 1;
+    }
+    IndexHeader header{};
+    std::memcpy(header.magic, INDEX_MAGIC, sizeof(header.magic));
+    header.floorNumber = static_cast<std::uint32_t>(floorNumber);
+    header.recordCount = count;
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    std::vector<SeedIndexRecord> records;
+    std::vector<std::string> runs;
+    bool ok = static_cast<bool>(file);
+    for (std::uint64_t done = 0; ok && done < count; done += records.size()) {
+        records.resize(static_cast<size_t>(std::min(count - done, CHUNK_RECORDS)));
+        measureRange(records, floorNumber, firstSeed + done, threadCount);
+        std::sort(records.begin(), records.end());
+
+        if (records.size() == count) {
+            ok = writeRecords(file, records.data(), records.size());
+        } else {
+            runs.push_back(path + ".run" + std::to_string(runs.size()));
+            std::ofstream run(runs.back(), std::ios::binary);
+            ok = run && writeRecords(run, records.data(), records.size());
+        }
+    }
+    records = {};
+
+    if (ok && !runs.empty()) {
+        ok = mergeRuns(runs, file);
+    }
+    for (const auto& run : runs) {
+        std::filesystem::remove(run);
+    }
+    if (!ok || !file) {
+        std::cerr << "Failed to write index: " << path << "\n";
+        return 1;
+    }
+
+    std::cout << "Indexed " << count << " seeds of floor " << floorNumber << " into " << path << "\n";
+    return 0;
+}
+
+// Whole-string decimal parse; rejects empty, signed and trailing input
+bool parseUnsigned(const char* text, std::uint64_t& value) {
+    if (!std::isdigit(static_cast<unsigned char>(text[0]))) return false;
+    char* end = nullptr;
+    errno = 0;
+    value = std::strtoull(text, &end, 10);
+    return errno == 0 && *end == '\0';
+}
+
+bool parseRange(const char* text, FloorQuery::Range& range) {
+    const char* colon = std::strchr(text, ':');
+    if (!colon) {
+        range.min = range.max = std::atoi(text);
+        return true;
+    }
+    if (colon != text) range.min = std::atoi(text);
+    if (colon[1] != '\0') range.max = std::atoi(colon + 1);
+    return range.min <= range.max;
+}
+
+// Reads only the records in the queried exit-depth range: a binary search
+// on the file finds the first one, then records stream in blocks
+int query(const std::string& path, const FloorQuery& constraints, std::uint64_t limit) {
+    std::ifstream file(path, std::ios::binary);
+    IndexHeader header{};
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        std::memcmp(header.magic, INDEX_MAGIC, sizeof(header.magic)) != 0) {
+        std::cerr << "Not a seed index: " << path << "\n";
+        return 1;
+    }
+
+    std::uint64_t available = (std::filesystem::file_size(path) - sizeof(header)) / sizeof(SeedIndexRecord);
+    if (header.recordCount > available) {
+        std::cerr << "Truncated seed index: " << path << "\n";
+        return 1;
+    }
+
+    auto seekRecord = [&file](std::uint64_t index) {
+        file.seekg(static_cast<std::streamoff>(sizeof(IndexHeader) + index * sizeof(SeedIndexRecord)));
+    };
+
+    // Records are sorted by exit depth first, so skip straight to the range
+    SeedIndexRecord lowest{0, {}};
+    lowest.metrics.exitDepth = static_cast<std::uint16_t>(std::max(constraints.exitDepth.min, 0));
+    std::uint64_t first = 0, last = header.recordCount;
+    while (first < last) {
+        std::uint64_t middle = first + (last - first) / 2;
+        SeedIndexRecord record;
+        seekRecord(middle);
+        file.read(reinterpret_cast<char*>(&record), sizeof(record));
+        if (record < lowest) {
+            first = middle + 1;
+        } else {
+            last = middle;
+        }
+    }
+
+    seekRecord(first);
+    std::vector<SeedIndexRecord> block(QUERY_BLOCK);
+    std::uint64_t found = 0;
+    bool inRange = true;
+    for (std::uint64_t next = first; inRange && found < limit && next < header.recordCount;) {
+        size_t count = static_cast<size_t>(std::min<std::uint64_t>(block.size(), header.recordCount - next));
+        if (!file.read(reinterpret_cast<char*>(block.data()),
+                       static_cast<std::streamsize>(count * sizeof(SeedIndexRecord)))) {
+            std::cerr << "Truncated seed index: " << path << "\n";
+            return 1;
+        }
+        next += count;
+
+        for (size_t i = 0; i < count && found < limit; ++i) {
+            const SeedIndexRecord& record = block[i];
+            if (record.metrics.exitDepth > constraints.exitDepth.max) {
+                inRange = false;
+                break;
+            }
+            if (!constraints.matches(record.metrics)) continue;
+            ++found;
+            std::cout << record.seed << " rooms=" << record.metrics.roomCount
+                      << " depth=" << record.metrics.exitDepth
+                      << " dead_ends=" << record.metrics.deadEnds
+                      << " branches=" << record.metrics.branchRooms << "\n";
+        }
+    }
+
+    std::cerr << found << " matching seeds (floor " << header.floorNumber << ")\n";
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    std::string mode = argv[1];
+    if (mode == "build" && (argc == 6 || argc == 7)) {
+        std::uint64_t floorNumber = 0, firstSeed = 0, count = 0;
+        std::uint64_t threads = std::max(1u, std::thread::hardware_concurrency());
+        if (!parseUnsigned(argv[3], floorNumber) || floorNumber < 1 || floorNumber > MAX_FLOOR) {
+            std::cerr << "Bad floor: " << argv[3] << " (expected 1 to " << MAX_FLOOR << ")\n";
+            return 1;
+        }
+        if (!parseUnsigned(argv[4], firstSeed) || !parseUnsigned(argv[5], count) ||
+            (argc == 7 && (!parseUnsigned(argv[6], threads) || threads == 0 || threads > 1024))) {
+            usage(argv[0]);
+            return 1;
+        }
+        return build(argv[2], static_cast<int>(floorNumber), firstSeed, count, static_cast<unsigned>(threads));
+    }
+
+    if (mode == "query") {
+        if ((argc - 3) % 2 != 0) {
+            usage(argv[0]);
+            return 1;
+        }
+
+        FloorQuery constraints;
+        std::uint64_t limit = ~0ull;
+        for (int i = 3; i + 1 < argc; i += 2) {
+            std::string option = argv[i];
+            bool ok = true;
+            if (option == "--rooms") ok = parseRange(argv[i + 1], constraints.roomCount);
+            else if (option == "--depth") ok = parseRange(argv[i + 1], constraints.exitDepth);
+            else if (option == "--dead-ends") ok = parseRange(argv[i + 1], constraints.deadEnds);
+            else if (option == "--branches") ok = parseRange(argv[i + 1], constraints.branchRooms);
+            else if (option == "--limit") ok = parseUnsigned(argv[i + 1], limit);
+            else ok = false;
+
+            if (!ok) {
+                std::cerr << "Bad option: " << option << " " << argv[i + 1] << "\n";
+                return 1;
+            }
+        }
+        return query(argv[2], constraints, limit);
+    }
+
+    usage(argv[0]);
+    return 1;
+}